@@ -23,97 +23,47 @@ static bool logging_enabled = false;
         }                                 \
     }
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+
 #include <vulkan/vk_layer.h>
 #include <vulkan/layer/vk_layer_settings.hpp>
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <vulkan/utility/vk_struct_helper.hpp>
 #include "allocator.h"
 #include "log.h"
 #include "vk_util.h"
 #include "decompression.h"
 #include "vk_common.h"
+#include "gdeflate.h"
 
-#include "shaders/spirv/copyCount_vk.h"
-
-#include "shaders/spirv/GInflate8_vk.h"
-#include "shaders/spirv/GInflate16_vk.h"
-#include "shaders/spirv/GInflate32_vk.h"
-#include "shaders/spirv/GInflate64_vk.h"
-#include "shaders/spirv/GInflate8_HAVE_INT16_vk.h"
-#include "shaders/spirv/GInflate16_HAVE_INT16_vk.h"
-#include "shaders/spirv/GInflate32_HAVE_INT16_vk.h"
-#include "shaders/spirv/GInflate64_HAVE_INT16_vk.h"
-#include "shaders/spirv/GInflate8_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate16_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate32_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate64_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate8_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate16_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate32_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/GInflate64_HAVE_INT16_HAVE_INT64_vk.h"
-
-#include "shaders/spirv/IndirectGInflate8_vk.h"
-#include "shaders/spirv/IndirectGInflate16_vk.h"
-#include "shaders/spirv/IndirectGInflate32_vk.h"
-#include "shaders/spirv/IndirectGInflate64_vk.h"
-#include "shaders/spirv/IndirectGInflate8_HAVE_INT16_vk.h"
-#include "shaders/spirv/IndirectGInflate16_HAVE_INT16_vk.h"
-#include "shaders/spirv/IndirectGInflate32_HAVE_INT16_vk.h"
-#include "shaders/spirv/IndirectGInflate64_HAVE_INT16_vk.h"
-#include "shaders/spirv/IndirectGInflate8_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate16_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate32_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate64_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate8_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate16_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate32_HAVE_INT16_HAVE_INT64_vk.h"
-#include "shaders/spirv/IndirectGInflate64_HAVE_INT16_HAVE_INT64_vk.h"
-
-static const ByteCode kGInflateBytecode[] = {
-    {(const uint8_t*)kGInflate8, sizeof(kGInflate8)},
-    {(const uint8_t*)kGInflate16, sizeof(kGInflate16)},
-    {(const uint8_t*)kGInflate32, sizeof(kGInflate32)},
-    {(const uint8_t*)kGInflate64, sizeof(kGInflate64)},
-
-    {(const uint8_t*)kGInflate8_HAVE_INT16, sizeof(kGInflate8_HAVE_INT16)},
-    {(const uint8_t*)kGInflate16_HAVE_INT16, sizeof(kGInflate16_HAVE_INT16)},
-    {(const uint8_t*)kGInflate32_HAVE_INT16, sizeof(kGInflate32_HAVE_INT16)},
-    {(const uint8_t*)kGInflate64_HAVE_INT16, sizeof(kGInflate64_HAVE_INT16)},
-
-    {(const uint8_t*)kGInflate8_HAVE_INT64, sizeof(kGInflate8_HAVE_INT64)},
-    {(const uint8_t*)kGInflate16_HAVE_INT64, sizeof(kGInflate16_HAVE_INT64)},
-    {(const uint8_t*)kGInflate32_HAVE_INT64, sizeof(kGInflate32_HAVE_INT64)},
-    {(const uint8_t*)kGInflate64_HAVE_INT64, sizeof(kGInflate64_HAVE_INT64)},
-
-    {(const uint8_t*)kGInflate8_HAVE_INT16_HAVE_INT64, sizeof(kGInflate8_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kGInflate16_HAVE_INT16_HAVE_INT64, sizeof(kGInflate16_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kGInflate32_HAVE_INT16_HAVE_INT64, sizeof(kGInflate32_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kGInflate64_HAVE_INT16_HAVE_INT64, sizeof(kGInflate64_HAVE_INT16_HAVE_INT64)},
-};
+#include "shaders/spirv/GInflate_vk.h"
 
-static const ByteCode kIndirectGInflateBytecode[] = {
-    {(const uint8_t*)kIndirectGInflate8, sizeof(kIndirectGInflate8)},
-    {(const uint8_t*)kIndirectGInflate16, sizeof(kIndirectGInflate16)},
-    {(const uint8_t*)kIndirectGInflate32, sizeof(kIndirectGInflate32)},
-    {(const uint8_t*)kIndirectGInflate64, sizeof(kIndirectGInflate64)},
-
-    {(const uint8_t*)kIndirectGInflate8_HAVE_INT16, sizeof(kIndirectGInflate8_HAVE_INT16)},
-    {(const uint8_t*)kIndirectGInflate16_HAVE_INT16, sizeof(kIndirectGInflate16_HAVE_INT16)},
-    {(const uint8_t*)kIndirectGInflate32_HAVE_INT16, sizeof(kIndirectGInflate32_HAVE_INT16)},
-    {(const uint8_t*)kIndirectGInflate64_HAVE_INT16, sizeof(kIndirectGInflate64_HAVE_INT16)},
-
-    {(const uint8_t*)kIndirectGInflate8_HAVE_INT64, sizeof(kIndirectGInflate8_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate16_HAVE_INT64, sizeof(kIndirectGInflate16_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate32_HAVE_INT64, sizeof(kIndirectGInflate32_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate64_HAVE_INT64, sizeof(kIndirectGInflate64_HAVE_INT64)},
-
-    {(const uint8_t*)kIndirectGInflate8_HAVE_INT16_HAVE_INT64, sizeof(kIndirectGInflate8_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate16_HAVE_INT16_HAVE_INT64, sizeof(kIndirectGInflate16_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate32_HAVE_INT16_HAVE_INT64, sizeof(kIndirectGInflate32_HAVE_INT16_HAVE_INT64)},
-    {(const uint8_t*)kIndirectGInflate64_HAVE_INT16_HAVE_INT64, sizeof(kIndirectGInflate64_HAVE_INT16_HAVE_INT64)},
-};
+// Entries of the Huffman lookup tables in GInflate.glsl: two 1024 entry primary tables and a pool of secondary tables
+static constexpr uint32_t kHuffmanLutSize = 2 * 1024 + 512;
+// Upper bound of the shared memory the GInflate shaders use besides the lookup tables
+static constexpr uint32_t kGInflateSharedMemorySize = 4096;
 
 #define kLayerSettingsForceEnable "force_enable"
 #define kLayerSettingsLogging "logging"
+#define kLayerSettingsGDeflateStreamFormat "gdeflate_stream_format"
+#define kLayerSettingsShaderSimdWidth "shader_simd_width"
+#define kLayerSettingsShaderInt16 "shader_int16"
+#define kLayerSettingsShaderInt64 "shader_int64"
+#define kLayerSettingsPipelineCachePath "pipeline_cache_path"
+#define kLayerSettingsTuningFile "tuning_file"
+#define kLayerSettingsHuffmanLut "huffman_lut"
+#define kLayerSettingsBatchCommands "batch_commands"
+#define kLayerSettingsInstrumentation "instrumentation"
+#define kLayerSettingsInstrumentationFile "instrumentation_file"
+#define kLayerSettingsInstrumentationPeriod "instrumentation_period"
 
 namespace memory_decompression {
 
@@ -129,8 +79,11 @@ const VkExtensionProperties kInstanceExtensionProperties[] = {
     VkExtensionProperties{VK_EXT_LAYER_SETTINGS_EXTENSION_NAME, VK_EXT_LAYER_SETTINGS_SPEC_VERSION}};
 const uint32_t kInstanceExtensionPropertiesCount = static_cast<uint32_t>(std::size(kInstanceExtensionProperties));
 
-static const VkExtensionProperties kDeviceExtension = {VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME,
-                                                       VK_NV_MEMORY_DECOMPRESSION_SPEC_VERSION};
+// Both extensions are implemented on top of the same kernels
+static const VkExtensionProperties kDeviceExtensions[] = {
+    {VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME, VK_NV_MEMORY_DECOMPRESSION_SPEC_VERSION},
+    {VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME, VK_EXT_MEMORY_DECOMPRESSION_SPEC_VERSION},
+};
 
 static vku::concurrent::unordered_map<uintptr_t, std::shared_ptr<InstanceData>> instance_data_map;
 static vku::concurrent::unordered_map<uintptr_t, std::shared_ptr<DeviceData>> device_data_map;
@@ -169,15 +122,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevi
         instance_data->vtable.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &count, nullptr);
         std::vector<VkExtensionProperties> extProps(count);
         instance_data->vtable.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &count, extProps.data());
-        bool decompressionExtFound = false;
-        for (uint32_t t = 0; t < count; t++) {
-            if (0 == strcmp(extProps[t].extensionName, kDeviceExtension.extensionName)) {
-                decompressionExtFound = true;
-                break;
+        // Do not add the extensions the implementation already supports
+        std::vector<VkExtensionProperties> missingExtensions;
+        for (const VkExtensionProperties& extension : kDeviceExtensions) {
+            auto same_name = [&extension](const VkExtensionProperties& props) {
+                return strcmp(props.extensionName, extension.extensionName) == 0;
+            };
+            if (std::none_of(extProps.begin(), extProps.end(), same_name)) {
+                missingExtensions.push_back(extension);
             }
         }
-        // Do not add the extension, if the implementation already supports VK_NV_MEMORY_DECOMPRESSION_EXTENSION
-        uint32_t extensionCount = decompressionExtFound ? count : count + 1;
+        uint32_t extensionCount = count + VecSize(missingExtensions);
         if (!pProperties) {
             *pPropertyCount = extensionCount;
             return VK_SUCCESS;
@@ -188,15 +143,15 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevi
         }
         instance_data->vtable.EnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &count, pProperties);
         *pPropertyCount = extensionCount;
-        // Add VK_NV_MEMORY_DECOMPRESSION_EXTENSION extension if the implementation doesn't support it
-        if (!decompressionExtFound) {
-            pProperties[count] = kDeviceExtension;
-        }
+        // Add the decompression extensions the implementation doesn't support
+        std::copy(missingExtensions.begin(), missingExtensions.end(), pProperties + count);
         return VK_SUCCESS;
     }
 
     VK_OUTARRAY_MAKE(out, pProperties, pPropertyCount);
-    vk_outarray_append(&out, prop) { *prop = kDeviceExtension; }
+    for (const VkExtensionProperties& extension : kDeviceExtensions) {
+        vk_outarray_append(&out, prop) { *prop = extension; }
+    }
     return vk_outarray_status(&out);
 }
 
@@ -300,7 +255,13 @@ void InitLayerSettings(const VkInstanceCreateInfo* pCreateInfo, const VkAllocati
     VkuLayerSettingSet layer_setting_set = VK_NULL_HANDLE;
     vkuCreateLayerSettingSet(kGlobalLayer.layerName, create_info, pAllocator, nullptr, &layer_setting_set);
 
-    static const char* setting_names[] = {kLayerSettingsForceEnable, kLayerSettingsLogging};
+    static const char* setting_names[] = {kLayerSettingsForceEnable,          kLayerSettingsLogging,
+                                          kLayerSettingsGDeflateStreamFormat, kLayerSettingsShaderSimdWidth,
+                                          kLayerSettingsShaderInt16,          kLayerSettingsShaderInt64,
+                                          kLayerSettingsPipelineCachePath,    kLayerSettingsTuningFile,
+                                          kLayerSettingsHuffmanLut,           kLayerSettingsBatchCommands,
+                                          kLayerSettingsInstrumentation,      kLayerSettingsInstrumentationFile,
+                                          kLayerSettingsInstrumentationPeriod};
     uint32_t setting_name_count = static_cast<uint32_t>(std::size(setting_names));
 
     std::vector<const char*> unknown_settings;
@@ -319,6 +280,50 @@ void InitLayerSettings(const VkInstanceCreateInfo* pCreateInfo, const VkAllocati
         vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsLogging, layer_settings->logging);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsGDeflateStreamFormat)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsGDeflateStreamFormat, layer_settings->gdeflate_stream_format);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsShaderSimdWidth)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsShaderSimdWidth, layer_settings->shader_simd_width);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsShaderInt16)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsShaderInt16, layer_settings->shader_int16);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsShaderInt64)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsShaderInt64, layer_settings->shader_int64);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsPipelineCachePath)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsPipelineCachePath, layer_settings->pipeline_cache_path);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsTuningFile)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsTuningFile, layer_settings->tuning_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsHuffmanLut)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsHuffmanLut, layer_settings->huffman_lut);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsBatchCommands)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsBatchCommands, layer_settings->batch_commands);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsInstrumentation)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsInstrumentation, layer_settings->instrumentation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsInstrumentationFile)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsInstrumentationFile, layer_settings->instrumentation_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsInstrumentationPeriod)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsInstrumentationPeriod, layer_settings->instrumentation_period);
+    }
+
     vkuDestroyLayerSettingSet(layer_setting_set, pAllocator);
 }
 
@@ -419,16 +424,59 @@ DeviceData::DeviceData(VkDevice device, PFN_vkGetDeviceProcAddr gpa, const Devic
         INIT_HOOK(vtable, device, DestroyPipeline);
         INIT_HOOK(vtable, device, CreatePipelineLayout);
         INIT_HOOK(vtable, device, CreateComputePipelines);
+        INIT_HOOK(vtable, device, CreatePipelineCache);
+        INIT_HOOK(vtable, device, DestroyPipelineCache);
+        INIT_HOOK(vtable, device, GetPipelineCacheData);
+        INIT_HOOK(vtable, device, AllocateCommandBuffers);
+        INIT_HOOK(vtable, device, FreeCommandBuffers);
+        INIT_HOOK(vtable, device, ResetCommandBuffer);
+        INIT_HOOK(vtable, device, ResetCommandPool);
+        INIT_HOOK(vtable, device, DestroyCommandPool);
         INIT_HOOK(vtable, device, BeginCommandBuffer);
         INIT_HOOK(vtable, device, CmdBindPipeline);
         INIT_HOOK(vtable, device, CmdPushConstants);
+        INIT_HOOK(vtable, device, CmdPushConstants2);
+        INIT_HOOK_ALIAS(vtable, device, CmdPushConstants2KHR, CmdPushConstants2);
+        INIT_HOOK(vtable, device, CmdBindShadersEXT);
+        INIT_HOOK(vtable, device, CreateQueryPool);
+        INIT_HOOK(vtable, device, DestroyQueryPool);
+        INIT_HOOK(vtable, device, GetQueryPoolResults);
         INIT_HOOK(vtable, device, CmdDispatch);
         INIT_HOOK(vtable, device, CmdDispatchIndirect);
+        INIT_HOOK(vtable, device, CmdDispatchBase);
+        INIT_HOOK_ALIAS(vtable, device, CmdDispatchBaseKHR, CmdDispatchBase);
         INIT_HOOK(vtable, device, CmdPipelineBarrier);
+        INIT_HOOK(vtable, device, CmdPipelineBarrier2);
+        INIT_HOOK_ALIAS(vtable, device, CmdPipelineBarrier2KHR, CmdPipelineBarrier2);
+        INIT_HOOK(vtable, device, CmdSetEvent);
+        INIT_HOOK(vtable, device, CmdResetEvent);
+        INIT_HOOK(vtable, device, CmdSetEvent2);
+        INIT_HOOK_ALIAS(vtable, device, CmdSetEvent2KHR, CmdSetEvent2);
+        INIT_HOOK(vtable, device, CmdResetEvent2);
+        INIT_HOOK_ALIAS(vtable, device, CmdResetEvent2KHR, CmdResetEvent2);
+        INIT_HOOK(vtable, device, CmdWaitEvents);
+        INIT_HOOK(vtable, device, CmdWaitEvents2);
+        INIT_HOOK_ALIAS(vtable, device, CmdWaitEvents2KHR, CmdWaitEvents2);
+        INIT_HOOK(vtable, device, CmdBeginQuery);
+        INIT_HOOK(vtable, device, CmdEndQuery);
+        INIT_HOOK(vtable, device, CmdWriteTimestamp);
+        INIT_HOOK(vtable, device, CmdResetQueryPool);
+        INIT_HOOK(vtable, device, CmdWriteTimestamp2);
+        INIT_HOOK_ALIAS(vtable, device, CmdWriteTimestamp2KHR, CmdWriteTimestamp2);
+        INIT_HOOK(vtable, device, CmdBeginRenderPass);
+        INIT_HOOK(vtable, device, CmdBeginRenderPass2);
+        INIT_HOOK_ALIAS(vtable, device, CmdBeginRenderPass2KHR, CmdBeginRenderPass2);
+        INIT_HOOK(vtable, device, CmdBeginRendering);
+        INIT_HOOK_ALIAS(vtable, device, CmdBeginRenderingKHR, CmdBeginRendering);
+        INIT_HOOK(vtable, device, CmdExecuteCommands);
         INIT_HOOK(vtable, device, EndCommandBuffer);
         INIT_HOOK(vtable, device, QueueSubmit);
+        INIT_HOOK(vtable, device, QueueSubmit2);
+        INIT_HOOK_ALIAS(vtable, device, QueueSubmit2KHR, QueueSubmit2);
         INIT_HOOK(vtable, device, CmdDecompressMemoryNV);
         INIT_HOOK(vtable, device, CmdDecompressMemoryIndirectCountNV);
+        INIT_HOOK(vtable, device, CmdDecompressMemoryEXT);
+        INIT_HOOK(vtable, device, CmdDecompressMemoryIndirectCountEXT);
     }
 }
 #undef INIT_HOOK
@@ -443,6 +491,209 @@ static inline uint32_t findFirstSetBit(uint32_t a) {
     return n;
 }
 
+// Returns the first memory type allowed by type_bits that has all of the required and preferred property flags,
+// falling back to one that only has the required flags. Returns UINT32_MAX if there is no such memory type.
+static uint32_t FindMemoryTypeIndex(const VkPhysicalDeviceMemoryProperties& memory_properties, uint32_t type_bits,
+                                    VkMemoryPropertyFlags required, VkMemoryPropertyFlags preferred) {
+    const VkMemoryPropertyFlags candidates[] = {required | preferred, required};
+    for (VkMemoryPropertyFlags property_flags : candidates) {
+        for (uint32_t t = 0; t < memory_properties.memoryTypeCount; ++t) {
+            if ((type_bits & (1u << t)) &&
+                property_flags == (property_flags & memory_properties.memoryTypes[t].propertyFlags)) {
+                return t;
+            }
+        }
+    }
+    return UINT32_MAX;
+}
+
+static std::string UuidToString(const uint8_t uuid[VK_UUID_SIZE]) {
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string text;
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+        text += kHexDigits[uuid[i] >> 4];
+        text += kHexDigits[uuid[i] & 0xf];
+    }
+    return text;
+}
+
+// Pipeline cache files are named after the cache UUID of the device and the shader variant, so that devices and
+// variants never share a file and a driver update starts a new one.
+static std::string PipelineCacheFileName(const std::string& directory, const VkPhysicalDeviceProperties& properties,
+                                         uint32_t bytecodeIndex) {
+    const std::string name =
+        "memory_decompression_" + UuidToString(properties.pipelineCacheUUID) + "_" + std::to_string(bytecodeIndex) + ".bin";
+    return (std::filesystem::path(directory) / name).string();
+}
+
+// Looks up the shader variant vk_decompression_benchmark --tune measured to be the fastest on the device. Every line
+// of the tuning file holds a pipeline cache UUID, a SIMD width, whether the variant uses 16-bit and 64-bit integers and
+// whether it decodes with the Huffman lookup tables.
+static bool ReadTunedVariant(const std::string& path, const VkPhysicalDeviceProperties& properties, uint32_t* width,
+                             bool* int16, bool* int64, bool* huffmanLut) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (file == nullptr) {
+        return false;
+    }
+    const std::string uuid = UuidToString(properties.pipelineCacheUUID);
+    bool found = false;
+    char line[256];
+    while (!found && fgets(line, sizeof(line), file) != nullptr) {
+        char lineUuid[2 * VK_UUID_SIZE + 1];
+        uint32_t lineWidth, lineInt16, lineInt64, lineHuffmanLut = 0;
+        // The Huffman lookup table column is optional, older files only list the bytecode variant
+        const int fields = sscanf(line, "%32s %u %u %u %u", lineUuid, &lineWidth, &lineInt16, &lineInt64, &lineHuffmanLut);
+        if (fields >= 4 && uuid == lineUuid) {
+            *width = lineWidth;
+            *int16 = lineInt16 != 0;
+            *int64 = lineInt64 != 0;
+            *huffmanLut = lineHuffmanLut != 0;
+            found = true;
+        }
+    }
+    fclose(file);
+    return found;
+}
+
+// Returns the content of a pipeline cache file, or nothing if it is missing or was written for another device
+static std::vector<uint8_t> ReadPipelineCacheFile(const std::string& path, const VkPhysicalDeviceProperties& properties) {
+    std::vector<uint8_t> data;
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return data;
+    }
+    uint8_t buffer[64 * 1024];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + read);
+    }
+    const bool ok = ferror(file) == 0;
+    fclose(file);
+
+    VkPipelineCacheHeaderVersionOne header;
+    if (!ok || data.size() < sizeof(header)) {
+        data.clear();
+        return data;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE || header.vendorID != properties.vendorID ||
+        header.deviceID != properties.deviceID ||
+        memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        data.clear();
+    }
+    return data;
+}
+
+// Writes the file under a temporary name first, so that concurrent processes never read a partial cache
+static bool WritePipelineCacheFile(const std::string& path, const std::vector<uint8_t>& data) {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+    const std::string temp_path = path + "." + std::to_string(std::random_device()()) + ".tmp";
+    FILE* file = fopen(temp_path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    if (fclose(file) != 0 || !written) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    return true;
+}
+
+// The SPIR-V variants are embedded as GDeflate streams, only the ones a device selects are decompressed
+static bool DecompressBytecode(uint32_t variant, std::vector<uint32_t>* code) {
+    const gdeflate::EmbeddedStream& stream = kGInflateSpirv[variant];
+    code->resize(stream.decompressed_size / sizeof(uint32_t));
+    return gdeflate::DecompressStream(kGInflateSpirvData + stream.offset, stream.size, reinterpret_cast<uint8_t*>(code->data()),
+                                      code->size() * sizeof(uint32_t), 1);
+}
+
+// Everything a background pipeline build reads, kept alive until the build is done
+struct PipelineBuild {
+    PipelineBuild(std::vector<uint32_t>&& code, VkPipelineLayout pipelineLayout, uint32_t requiredSubgroupSize)
+        : bytecode(std::move(code)), layout(pipelineLayout) {
+        rss_info.requiredSubgroupSize = requiredSubgroupSize;
+    }
+
+    // Constants the shader does not declare are ignored, so both shaders take the same ones
+    void Specialize(VkBool32 streamFormat, uint32_t huffmanLutSize) {
+        specData = {streamFormat, huffmanLutSize};
+        specEntries[0] = {0, offsetof(SpecializationData, streamFormat), sizeof(VkBool32)};
+        specEntries[1] = {1, offsetof(SpecializationData, huffmanLutSize), sizeof(uint32_t)};
+        specInfo = {2, specEntries, sizeof(specData), &specData};
+        specialized = true;
+    }
+
+    struct SpecializationData {
+        VkBool32 streamFormat;    // Constant 0, whole GDeflate streams per command
+        uint32_t huffmanLutSize;  // Constant 1, entries of the Huffman lookup tables, one disables them
+    };
+
+    std::vector<uint32_t> bytecode;
+    VkPipelineLayout layout;
+    VkPipelineShaderStageRequiredSubgroupSizeCreateInfo rss_info = {
+        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO};
+    SpecializationData specData = {VK_FALSE, 1};
+    VkSpecializationMapEntry specEntries[2] = {};
+    VkSpecializationInfo specInfo = {};
+    bool specialized = false;
+};
+
+static VkPipeline BuildComputePipeline(DeviceData& device_data, const PipelineBuild& build) {
+    auto& vtable = device_data.vtable;
+
+    VkShaderModuleCreateInfo shaderModuleInfo = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    shaderModuleInfo.codeSize = build.bytecode.size() * sizeof(uint32_t);
+    shaderModuleInfo.pCode = build.bytecode.data();
+    VkShaderModule shaderModule;
+    VkResult result = vtable.CreateShaderModule(device_data.device, &shaderModuleInfo, 0, &shaderModule);
+    if (result != VK_SUCCESS) {
+        PRINT("Error: CreateShaderModule failed with error %d\n", result);
+        return VK_NULL_HANDLE;
+    }
+
+    VkComputePipelineCreateInfo pipelineInfo = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    pipelineInfo.layout = build.layout;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = shaderModule;
+    pipelineInfo.stage.pName = "main";
+    if (build.specialized) {
+        pipelineInfo.stage.pSpecializationInfo = &build.specInfo;
+    }
+    if (build.rss_info.requiredSubgroupSize != 0) {
+        pipelineInfo.stage.pNext = &build.rss_info;
+    }
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    result = vtable.CreateComputePipelines(device_data.device, device_data.pipelineCache, 1, &pipelineInfo, 0, &pipeline);
+    vtable.DestroyShaderModule(device_data.device, shaderModule, 0);
+    if (result != VK_SUCCESS) {
+        PRINT("Error: CreateComputePipelines failed with error %d\n", result);
+        return VK_NULL_HANDLE;
+    }
+    return pipeline;
+}
+
+// Builds the pipeline on its own thread, the last build to finish stores the pipeline cache
+static void StartPipelineBuild(DeviceData& device_data, DeferredPipeline& deferred, std::shared_ptr<PipelineBuild> build) {
+    std::promise<VkPipeline> promise;
+    deferred.pipeline = promise.get_future().share();
+    deferred.thread = std::thread([&device_data, build, promise = std::move(promise)]() mutable {
+        promise.set_value(BuildComputePipeline(device_data, *build));
+        if (--device_data.pendingPipelines == 0) {
+            device_data.StorePipelineCache();
+        }
+    });
+}
+
 static VkLayerDeviceCreateInfo* GetChainInfo(const VkDeviceCreateInfo* pCreateInfo, VkLayerFunction func) {
     auto chain_info = reinterpret_cast<VkLayerDeviceCreateInfo*>(const_cast<void*>(pCreateInfo->pNext));
     while (chain_info && !(chain_info->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO && chain_info->function == func)) {
@@ -485,6 +736,10 @@ VkResult DeviceData::CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice phy
     devFeatures.pNext = &subgroupFeatures;
     GetPhysicalDeviceFeatures2Internal(physicalDevice, &devFeatures);
 
+    memoryProperties = pdd->memoryProperties;
+    maxComputeWorkGroupCountX = props.properties.limits.maxComputeWorkGroupCount[0];
+    maxPushConstantsSize = props.properties.limits.maxPushConstantsSize;
+
     uint32_t subgroupSize = 32;
     if (!subgroupFeatures.subgroupSizeControl || subgroupsizeProps.minSubgroupSize < 16) {
         // If we do not have size control extension, or width < 16
@@ -511,8 +766,37 @@ VkResult DeviceData::CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice phy
         }
     }
 
+    // A variant measured on this device replaces the heuristics above, unless a width is forced
+    if (!tuningFile.empty() && shaderSimdWidth == 0) {
+        if (ReadTunedVariant(tuningFile, props.properties, &shaderSimdWidth, &shaderInt16, &shaderInt64, &huffmanLut)) {
+            PRINT("Info: Using tuned variant width %u int16 %u int64 %u huffman_lut %u from %s\n", shaderSimdWidth, shaderInt16,
+                  shaderInt64, huffmanLut, tuningFile.c_str());
+        } else {
+            PRINT("Info: No tuned variant for this device in %s\n", tuningFile.c_str());
+        }
+    }
+
+    if (shaderSimdWidth != 0) {
+        // The 8 wide variant only synchronizes through shared memory, wider ones need subgroups of exactly that width
+        const bool supported = shaderSimdWidth == 8 || (subgroupFeatures.subgroupSizeControl &&
+                                                        shaderSimdWidth >= subgroupsizeProps.minSubgroupSize &&
+                                                        shaderSimdWidth <= subgroupsizeProps.maxSubgroupSize);
+        if (supported) {
+            subgroupSize = shaderSimdWidth;
+        } else {
+            PRINT("Warning: Shader SIMD width %u is not supported by the device, using %u\n", shaderSimdWidth, subgroupSize);
+        }
+    }
+
     PRINT("Info: subgroupSize %u\n", subgroupSize);
 
+    // The lookup tables come on top of the shared memory the shaders otherwise use
+    if (huffmanLut &&
+        props.properties.limits.maxComputeSharedMemorySize < kHuffmanLutSize * sizeof(uint32_t) + kGInflateSharedMemorySize) {
+        PRINT("Warning: Not enough shared memory for the Huffman lookup tables, using the canonical decoder\n");
+        huffmanLut = false;
+    }
+
     if (subgroupSize != 8 && subgroupSize != 16 && subgroupSize != 32 && subgroupSize != 64) {
         // Only 8, 16, 32 and 64 are supported
         PRINT("Error: Unsupported subgroupSize %u\n", subgroupSize);
@@ -521,30 +805,20 @@ VkResult DeviceData::CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice phy
 
     uint32_t bytecodeIndex = 0;
     bytecodeIndex += findFirstSetBit(subgroupSize) - 3;
-    bytecodeIndex += (devFeatures.features.shaderInt16 ? 4 : 0);
-    bytecodeIndex += (devFeatures.features.shaderInt64 ? 8 : 0);
+    bytecodeIndex += (devFeatures.features.shaderInt16 && shaderInt16 ? 4 : 0);
+    bytecodeIndex += (devFeatures.features.shaderInt64 && shaderInt64 ? 8 : 0);
     PRINT("Info: bytecodeIndex %u\n", bytecodeIndex);
 
-    size_t byteCodeArrLength = sizeof(kGInflateBytecode) / sizeof(kGInflateBytecode[0]);
-    size_t byteCodeIndirectArrLength = sizeof(kIndirectGInflateBytecode) / sizeof(kIndirectGInflateBytecode[0]);
-
-    // Must have all shaders for both direct/indirect mode
-    // byteCodeIndex must pick a valid shader
-    if ((byteCodeArrLength != byteCodeIndirectArrLength) && (bytecodeIndex >= byteCodeArrLength)) {
-        PRINT("Error: Unsupported bytecodeIndex %u\n", bytecodeIndex);
+    // Must have all shaders for both direct/indirect mode, the indirect variants follow the direct ones
+    constexpr uint32_t kBytecodeVariants = 16;
+    static_assert(std::size(kGInflateSpirv) == 2 * kBytecodeVariants, "GInflate_vk.h must hold every shader variant");
+    std::vector<uint32_t> singleBytecode;
+    std::vector<uint32_t> multiBytecode;
+    if (!DecompressBytecode(bytecodeIndex, &singleBytecode) ||
+        !DecompressBytecode(kBytecodeVariants + bytecodeIndex, &multiBytecode)) {
+        PRINT("Error: Cannot decompress the shaders of bytecodeIndex %u\n", bytecodeIndex);
         return VK_ERROR_INITIALIZATION_FAILED;
     }
-    // create indirect buffer with data {[indirectCommandsAddress], 1,1}
-    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    bufferInfo.size = 3 * sizeof(uint32_t);
-    bufferInfo.usage =
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
-    result = vtable.CreateBuffer(device, &bufferInfo, 0, &indirectDispatchBuffer);
-    if (result != VK_SUCCESS) {
-        PRINT("Error: CreateBuffer with error %u\n", result);
-        return result;
-    }
-
     {
         PRINT("Info: Memory Heaps/Types:\n");
         for (uint32_t t = 0; t < pdd->memoryProperties.memoryHeapCount; t++) {
@@ -557,70 +831,40 @@ VkResult DeviceData::CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice phy
         }
     }
 
-    VkMemoryRequirements reqs;
-    vtable.GetBufferMemoryRequirements(*pDevice, indirectDispatchBuffer, &reqs);
-    VkMemoryPropertyFlags property_flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    uint32_t mem_type_index = 0;
-    for (mem_type_index = 0; mem_type_index < pdd->memoryProperties.memoryTypeCount; ++mem_type_index) {
-        if (property_flags == (property_flags & pdd->memoryProperties.memoryTypes[mem_type_index].propertyFlags)) break;
-    }
-    indirectDispatchBufferMemory = 0;
-    if (mem_type_index < pdd->memoryProperties.memoryTypeCount) {
-        PRINT("Info: Using memory index %u for indirectDispatch Buffer.\n", mem_type_index);
-        VkMemoryAllocateFlagsInfo memFlagsInfo = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO};
-        memFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
-        VkMemoryAllocateInfo memInfo = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
-        memInfo.pNext = &memFlagsInfo;
-        memInfo.allocationSize = reqs.size;
-        memInfo.memoryTypeIndex = mem_type_index;
-        result = vtable.AllocateMemory(device, &memInfo, 0, &indirectDispatchBufferMemory);
-        if (result != VK_SUCCESS) {
-            return result;
-        }
-        result = vtable.BindBufferMemory(device, indirectDispatchBuffer, indirectDispatchBufferMemory, 0);
-        if (result != VK_SUCCESS) {
-            return result;
-        }
-        uint32_t* dispatchData;
-        result = vtable.MapMemory(device, indirectDispatchBufferMemory, 0, reqs.size, 0, (void**)&dispatchData);
-        if (result != VK_SUCCESS) {
-            return result;
-        }
-        *(dispatchData) = 1;
-        *(dispatchData + 1) = 1;
-        *(dispatchData + 2) = 1;
-        vtable.UnmapMemory(device, indirectDispatchBufferMemory);
+    // Upload memory is written by the host while recording and read by the decompression shaders,
+    // prefer memory that is also device local when the implementation exposes it.
+    uploadMemoryTypeIndex =
+        FindMemoryTypeIndex(memoryProperties, ~0u, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    PRINT("Info: Using memory index %u for transient upload memory.\n", uploadMemoryTypeIndex);
+    upload_pool.Init(this, uploadMemoryTypeIndex, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+
+    if (instrumentation) {
+        timestampPeriod = props.properties.limits.timestampPeriod;
+        timestamp_pools.Init(this);
+        dumpTime = std::chrono::steady_clock::now();
     }
-    if (!indirectDispatchBufferMemory) {
-        // Could not find appropriate memory type
-        PRINT("Error: Could not create memory for indirect Buffer\n");
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
-    }
-    VkBufferDeviceAddressInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, NULL, indirectDispatchBuffer};
-    indirectDispatchBufferAddress = vtable.GetBufferDeviceAddress(device, &buffer_info);
-
-    VkShaderModule decompressShaderModule;
-    VkShaderModule copyCountModule;
-    VkShaderModule indirectDecompressShaderModule;
 
-    VkPipelineShaderStageRequiredSubgroupSizeCreateInfo rss_info = {
-        VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO};
-    rss_info.requiredSubgroupSize = subgroupSize;
+    // Pipelines are built through a cache persisted in pipelineCachePath, so that later devices only pay for a lookup
+    if (!pipelineCachePath.empty()) {
+        pipelineCacheFile = PipelineCacheFileName(pipelineCachePath, props.properties, bytecodeIndex);
+        initialPipelineCacheData = ReadPipelineCacheFile(pipelineCacheFile, props.properties);
+        PRINT("Info: Loaded %zu bytes of pipeline cache from %s\n", initialPipelineCacheData.size(), pipelineCacheFile.c_str());
 
-    // Create Decompression shader pipeline
-    ByteCode bytecode = kGInflateBytecode[bytecodeIndex];
-    VkShaderModuleCreateInfo shaderModuleInfo = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
-    shaderModuleInfo.codeSize = bytecode.size;
-    shaderModuleInfo.pCode = reinterpret_cast<const uint32_t*>(bytecode.code);
-    result = vtable.CreateShaderModule(device, &shaderModuleInfo, 0, &decompressShaderModule);
-    if (result != VK_SUCCESS) {
-        return result;
+        VkPipelineCacheCreateInfo cacheInfo = {VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+        cacheInfo.initialDataSize = initialPipelineCacheData.size();
+        cacheInfo.pInitialData = initialPipelineCacheData.data();
+        result = vtable.CreatePipelineCache(device, &cacheInfo, 0, &pipelineCache);
+        if (result != VK_SUCCESS) {
+            PRINT("Warning: CreatePipelineCache failed with error %d, building pipelines without a cache\n", result);
+            pipelineCache = VK_NULL_HANDLE;
+        }
     }
-    // create pipeline
+
     VkPushConstantRange pushConstantRange;
     pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
     pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(VkDecompressMemoryRegionNV);
+    pushConstantRange.size = sizeof(VkDecompressMemoryRegionEXT);
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
     pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
     pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
@@ -629,89 +873,322 @@ VkResult DeviceData::CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice phy
         return result;
     }
 
-    VkComputePipelineCreateInfo pipelineInfo = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
-    pipelineInfo.layout = pipelineLayoutDecompressSingle;
-    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    pipelineInfo.stage.module = decompressShaderModule;
-    pipelineInfo.stage.pName = "main";
-
-    if (subgroupFeatures.subgroupSizeControl) {
-        pipelineInfo.stage.pNext = &rss_info;
-    }
-
-    result = vtable.CreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, 0, &pipelineDecompressSingle);
+    pushConstantRange.size = sizeof(PushConstantDataDecompressMulti);
+    result = vtable.CreatePipelineLayout(device, &pipelineLayoutCreateInfo, 0, &pipelineLayoutDecompressMulti);
     if (result != VK_SUCCESS) {
         return result;
     }
-    vtable.DestroyShaderModule(device, decompressShaderModule, 0);
 
-    // Create copy shader pipeline
-    ByteCode copyCountBytecode = {(const uint8_t*)copyCount, sizeof(copyCount)};
-    shaderModuleInfo.codeSize = copyCountBytecode.size;
-    shaderModuleInfo.pCode = reinterpret_cast<const uint32_t*>(copyCountBytecode.code);
-    result = vtable.CreateShaderModule(device, &shaderModuleInfo, 0, &copyCountModule);
-    if (result != VK_SUCCESS) {
-        return result;
+    const bool requireSubgroupSize = subgroupFeatures.subgroupSizeControl && subgroupSize >= subgroupsizeProps.minSubgroupSize &&
+                                     subgroupSize <= subgroupsizeProps.maxSubgroupSize;
+    auto singleBuild = std::make_shared<PipelineBuild>(std::move(singleBytecode), pipelineLayoutDecompressSingle,
+                                                       requireSubgroupSize ? subgroupSize : 0);
+    auto multiBuild = std::make_shared<PipelineBuild>(std::move(multiBytecode), pipelineLayoutDecompressMulti,
+                                                      requireSubgroupSize ? subgroupSize : 0);
+    // Specialization constant 0 selects between raw tiles and whole GDeflate streams per command, constant 1 sizes the
+    // Huffman lookup tables of the table-driven decoder
+    const uint32_t huffmanLutSize = huffmanLut ? kHuffmanLutSize : 1;
+    singleBuild->Specialize(VK_FALSE, huffmanLutSize);
+    multiBuild->Specialize(streamFormat ? VK_TRUE : VK_FALSE, huffmanLutSize);
+
+    // Compiling the GInflate shaders takes the driver a while, do it in the background and only make the first
+    // command that records a decompression wait for it
+    pendingPipelines = 2;
+    StartPipelineBuild(*this, pipelineDecompressSingle, singleBuild);
+    StartPipelineBuild(*this, pipelineDecompressMulti, multiBuild);
+
+    return VK_SUCCESS;
+}
+
+void TransientBlockPool::Init(DeviceData* device_data, uint32_t memory_type_index, VkBufferUsageFlags usage) {
+    device_data_ = device_data;
+    memory_type_index_ = memory_type_index;
+    usage_ = usage;
+}
+
+void TransientBlockPool::Destroy() {
+    std::lock_guard<std::mutex> lock(lock_);
+    for (const auto& block : free_blocks_) {
+        DestroyBlock(block);
     }
+    free_blocks_.clear();
+}
 
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(PushConstantDataCopy);
-    pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
-    pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
-    result = vtable.CreatePipelineLayout(device, &pipelineLayoutCreateInfo, 0, &pipelineLayoutCopy);
+VkResult TransientBlockPool::CreateBlock(VkDeviceSize size, TransientBlock* block) {
+    auto& vtable = device_data_->vtable;
+    VkDevice device = device_data_->device;
+
+    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bufferInfo.size = size;
+    bufferInfo.usage = usage_;
+    VkResult result = vtable.CreateBuffer(device, &bufferInfo, 0, &block->buffer);
     if (result != VK_SUCCESS) {
         return result;
     }
-    pipelineInfo.layout = pipelineLayoutCopy;
-    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    pipelineInfo.stage.module = copyCountModule;
-    pipelineInfo.stage.pName = "main";
-    pipelineInfo.stage.pNext = NULL;
-    result = vtable.CreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, 0, &pipelineCopy);
-    if (result != VK_SUCCESS) {
-        return result;
+    block->size = size;
+
+    VkMemoryRequirements reqs;
+    vtable.GetBufferMemoryRequirements(device, block->buffer, &reqs);
+    if (memory_type_index_ == UINT32_MAX || (reqs.memoryTypeBits & (1u << memory_type_index_)) == 0) {
+        DestroyBlock(*block);
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
     }
-    vtable.DestroyShaderModule(device, copyCountModule, 0);
 
-    // Create indirect decompression shader pipeline
-    ByteCode bytecodeIndirect = kIndirectGInflateBytecode[bytecodeIndex];
-    shaderModuleInfo.codeSize = bytecodeIndirect.size;
-    shaderModuleInfo.pCode = reinterpret_cast<const uint32_t*>(bytecodeIndirect.code);
-    result = vtable.CreateShaderModule(device, &shaderModuleInfo, 0, &indirectDecompressShaderModule);
+    VkMemoryAllocateFlagsInfo memFlagsInfo = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO};
+    memFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    VkMemoryAllocateInfo memInfo = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    memInfo.pNext = &memFlagsInfo;
+    memInfo.allocationSize = reqs.size;
+    memInfo.memoryTypeIndex = memory_type_index_;
+    result = vtable.AllocateMemory(device, &memInfo, 0, &block->memory);
+    if (result == VK_SUCCESS) {
+        result = vtable.BindBufferMemory(device, block->buffer, block->memory, 0);
+    }
+    if (result == VK_SUCCESS) {
+        result = vtable.MapMemory(device, block->memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void**>(&block->mapped));
+    }
     if (result != VK_SUCCESS) {
+        DestroyBlock(*block);
         return result;
     }
 
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(PushConstantDataDecompressMulti);
-    pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
-    pipelineLayoutCreateInfo.pPushConstantRanges = &pushConstantRange;
-    result = vtable.CreatePipelineLayout(device, &pipelineLayoutCreateInfo, 0, &pipelineLayoutDecompressMulti);
-    if (result != VK_SUCCESS) {
-        return result;
+    VkBufferDeviceAddressInfo addressInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, NULL, block->buffer};
+    block->address = vtable.GetBufferDeviceAddress(device, &addressInfo);
+    return VK_SUCCESS;
+}
+
+void TransientBlockPool::DestroyBlock(const TransientBlock& block) {
+    device_data_->vtable.DestroyBuffer(device_data_->device, block.buffer, 0);
+    if (block.memory) {
+        // Freeing the memory implicitly unmaps it
+        device_data_->vtable.FreeMemory(device_data_->device, block.memory, 0);
     }
+}
 
-    pipelineInfo.layout = pipelineLayoutDecompressMulti;
-    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    pipelineInfo.stage.module = indirectDecompressShaderModule;
-    pipelineInfo.stage.pName = "main";
+VkResult TransientBlockPool::Acquire(VkDeviceSize min_size, TransientBlock* block) {
+    // Requests larger than a block get a dedicated block that is destroyed rather than recycled on release
+    if (min_size > kBlockSize) {
+        return CreateBlock(min_size, block);
+    }
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!free_blocks_.empty()) {
+            *block = free_blocks_.front();
+            free_blocks_.pop_front();
+            return VK_SUCCESS;
+        }
+    }
+    PRINT("Info: Growing transient memory by %llu bytes\n", (unsigned long long)kBlockSize);
+    return CreateBlock(kBlockSize, block);
+}
 
-    if (subgroupFeatures.subgroupSizeControl) {
-        pipelineInfo.stage.pNext = &rss_info;
+void TransientBlockPool::Release(std::vector<TransientBlock>& blocks) {
+    std::lock_guard<std::mutex> lock(lock_);
+    for (const auto& block : blocks) {
+        if (block.size == kBlockSize) {
+            free_blocks_.push_back(block);
+        } else {
+            DestroyBlock(block);
+        }
     }
+    blocks.clear();
+}
 
-    result = vtable.CreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, 0, &pipelineDecompressMulti);
-    if (result != VK_SUCCESS) {
-        return result;
+VkResult DeviceData::AllocateTransient(TransientRing& ring, VkDeviceSize size, VkDeviceSize alignment,
+                                       TransientAllocation* allocation) {
+    VkDeviceSize offset = (ring.offset + alignment - 1) & ~(alignment - 1);
+    if (ring.blocks.empty() || offset + size > ring.blocks.back().size) {
+        TransientBlock block;
+        VkResult result = upload_pool.Acquire(size, &block);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        ring.blocks.push_back(block);
+        offset = 0;
     }
-    vtable.DestroyShaderModule(device, indirectDecompressShaderModule, 0);
+    const TransientBlock& block = ring.blocks.back();
+    ring.offset = offset + size;
 
+    allocation->buffer = block.buffer;
+    allocation->offset = offset;
+    allocation->address = block.address + offset;
+    allocation->mapped = block.mapped + offset;
     return VK_SUCCESS;
 }
 
+void TimestampQueryPools::Init(DeviceData* device_data) { device_data_ = device_data; }
+
+void TimestampQueryPools::Destroy() {
+    std::lock_guard<std::mutex> lock(lock_);
+    for (VkQueryPool pool : free_pools_) {
+        device_data_->vtable.DestroyQueryPool(device_data_->device, pool, 0);
+    }
+    free_pools_.clear();
+}
+
+VkResult TimestampQueryPools::Acquire(VkQueryPool* pool) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!free_pools_.empty()) {
+            *pool = free_pools_.back();
+            free_pools_.pop_back();
+            return VK_SUCCESS;
+        }
+    }
+    VkQueryPoolCreateInfo poolInfo = {VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = kQueryCount;
+    return device_data_->vtable.CreateQueryPool(device_data_->device, &poolInfo, 0, pool);
+}
+
+void TimestampQueryPools::Release(std::vector<VkQueryPool>& pools) {
+    std::lock_guard<std::mutex> lock(lock_);
+    free_pools_.insert(free_pools_.end(), pools.begin(), pools.end());
+    pools.clear();
+}
+
+// A command buffer is recorded by one thread at a time, which records many commands in a row, so each thread keeps the
+// data of the last command buffer it looked up. Freeing command buffers changes the generation, as their handles may be
+// reused for other command buffers.
+static std::atomic<uint64_t> command_buffer_generation{1};
+
+struct CommandBufferCache {
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    uint64_t generation = 0;
+    CommandBufferData* cb_data = nullptr;
+};
+static thread_local CommandBufferCache command_buffer_cache;
+
+static void InvalidateCommandBufferCaches() { command_buffer_generation.fetch_add(1, std::memory_order_release); }
+
+CommandBufferData* DeviceData::GetCommandBufferData(VkCommandBuffer command_buffer) {
+    const uint64_t generation = command_buffer_generation.load(std::memory_order_acquire);
+    if (command_buffer_cache.command_buffer == command_buffer && command_buffer_cache.generation == generation) {
+        return command_buffer_cache.cb_data;
+    }
+    CommandBufferData* cb_data;
+    auto result = command_buffer_map.find(command_buffer);
+    if (result != command_buffer_map.end()) {
+        cb_data = result->second.get();
+    } else {
+        // Command buffers allocated before the layer started tracking them are not associated with a pool
+        auto new_cb_data = std::make_shared<CommandBufferData>();
+        command_buffer_map.insert(command_buffer, new_cb_data);
+        cb_data = new_cb_data.get();
+    }
+    command_buffer_cache = {command_buffer, generation, cb_data};
+    return cb_data;
+}
+
+void DeviceData::ReleaseCommandBufferResources(CommandBufferData& cb_data) {
+    upload_pool.Release(cb_data.upload_ring.blocks);
+    cb_data.upload_ring.offset = 0;
+    if (!cb_data.batched_regions.empty()) {
+        cb_data.batched_regions.clear();
+        batchedCommandBuffers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (cb_data.compute_state.replaced) {
+        replacedComputeStates.fetch_sub(1, std::memory_order_relaxed);
+    }
+    cb_data.compute_state.Reset();
+    if (instrumentation && !cb_data.timestamps.pools.empty()) {
+        CollectTimestamps(cb_data.timestamps);
+        DumpStatistics(false);
+    }
+}
+
+// The command buffer is not pending anymore, so the timestamps of the dispatches it executed are available. Dispatches of
+// a command buffer that was recorded but never submitted have none and are not counted.
+void DeviceData::CollectTimestamps(TimestampRing& ring) {
+    VkMemoryDecompressionStatisticsKHRONOS collected = {};
+    for (const TimestampSample& sample : ring.samples) {
+        // Start and end timestamps, each followed by its availability
+        uint64_t results[4] = {};
+        vtable.GetQueryPoolResults(device, sample.pool, sample.query, 2, sizeof(results), results, 2 * sizeof(uint64_t),
+                                   VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (results[1] == 0 || results[3] == 0 || results[2] < results[0]) {
+            continue;
+        }
+        collected.dispatchCount++;
+        collected.regionCount += sample.region_count;
+        collected.compressedBytes += sample.compressed_size;
+        collected.decompressedBytes += sample.decompressed_size;
+        collected.gpuNanoseconds += static_cast<uint64_t>(static_cast<double>(results[2] - results[0]) * timestampPeriod);
+    }
+    timestamp_pools.Release(ring.pools);
+    ring.next_query = 0;
+    ring.samples.clear();
+
+    std::lock_guard<std::mutex> lock(statisticsLock);
+    statistics.dispatchCount += collected.dispatchCount;
+    statistics.regionCount += collected.regionCount;
+    statistics.compressedBytes += collected.compressedBytes;
+    statistics.decompressedBytes += collected.decompressedBytes;
+    statistics.gpuNanoseconds += collected.gpuNanoseconds;
+}
+
+// Appends what was collected since the last line to instrumentationFile, once per instrumentationPeriod unless forced
+void DeviceData::DumpStatistics(bool force) {
+    std::lock_guard<std::mutex> lock(statisticsLock);
+    if (instrumentationFile.empty()) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - dumpTime);
+    if (!force && elapsed.count() < instrumentationPeriod) {
+        return;
+    }
+    FILE* file = fopen(instrumentationFile.c_str(), "a");
+    if (file == nullptr) {
+        PRINT("Warning: Could not open %s, disabling the statistics file\n", instrumentationFile.c_str());
+        instrumentationFile.clear();
+        return;
+    }
+    fseek(file, 0, SEEK_END);
+    if (ftell(file) == 0) {
+        fprintf(file, "device,milliseconds,dispatches,regions,compressed_bytes,decompressed_bytes,gpu_ns\n");
+    }
+    fprintf(file, "%p,%lld,%llu,%llu,%llu,%llu,%llu\n", static_cast<void*>(device), static_cast<long long>(elapsed.count()),
+            static_cast<unsigned long long>(statistics.dispatchCount - dumpedStatistics.dispatchCount),
+            static_cast<unsigned long long>(statistics.regionCount - dumpedStatistics.regionCount),
+            static_cast<unsigned long long>(statistics.compressedBytes - dumpedStatistics.compressedBytes),
+            static_cast<unsigned long long>(statistics.decompressedBytes - dumpedStatistics.decompressedBytes),
+            static_cast<unsigned long long>(statistics.gpuNanoseconds - dumpedStatistics.gpuNanoseconds));
+    fclose(file);
+    dumpedStatistics = statistics;
+    dumpTime = now;
+}
+
+// True if the app enables one of the decompression extensions and the implementation does not support that one. The
+// feature struct is shared by both extensions, so it does not tell them apart.
+static bool EnablesUnsupportedExtension(InstanceData& instance_data, VkPhysicalDevice physicalDevice,
+                                        const VkDeviceCreateInfo* pCreateInfo) {
+    uint32_t count = 0;
+    instance_data.vtable.EnumerateDeviceExtensionProperties(physicalDevice, nullptr, &count, nullptr);
+    std::vector<VkExtensionProperties> extProps(count);
+    instance_data.vtable.EnumerateDeviceExtensionProperties(physicalDevice, nullptr, &count, extProps.data());
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
+        const char* name = pCreateInfo->ppEnabledExtensionNames[i];
+        auto is_decompression = [name](const VkExtensionProperties& props) { return strcmp(props.extensionName, name) == 0; };
+        if (std::any_of(std::begin(kDeviceExtensions), std::end(kDeviceExtensions), is_decompression) &&
+            std::none_of(extProps.begin(), extProps.begin() + count, is_decompression)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool EnablesDecompressionExtension(const VkDeviceCreateInfo* pCreateInfo) {
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
+        const char* name = pCreateInfo->ppEnabledExtensionNames[i];
+        auto is_decompression = [name](const VkExtensionProperties& props) { return strcmp(props.extensionName, name) == 0; };
+        if (std::any_of(std::begin(kDeviceExtensions), std::end(kDeviceExtensions), is_decompression)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
                                             const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
     VkResult result;
@@ -760,30 +1237,44 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, con
             if (instance_data->layer_settings.force_enable) {
                 PRINT("Memory decompression feature available in the driver, but force enabling decompression layer.\n");
                 enable_layer = true;
+            } else if (EnablesUnsupportedExtension(*instance_data, physicalDevice, pCreateInfo)) {
+                PRINT("Memory decompression extension enabled but not available in the driver, enabling decompression layer.\n");
+                enable_layer = true;
             } else {
                 PRINT("Memory decompression feature available in the driver, not using decompression layer.\n");
             }
         }
 
-        // Filter out our extension name and feature struct, in a copy of the create info.
-        // Only enable device hooks if memory decompression extension is enabled AND
-        // the physical device doesn't support it already or we are force enabled.
-        if (enable_layer) {
-            // The layer requires 8-bit integer support,
-            // basic subgroup feature in the compute stage and
-            // bufferDeviceAddress feature
-            if (!computeStageSupport || !subgroupBasicSupport || !vulkan12Features.shaderInt8 ||
-                !vulkan12Features.bufferDeviceAddress) {
-                PRINT("Info: computeStageSupport %u\n", computeStageSupport);
-                PRINT("Info: subgroupBasicSupport %u\n", subgroupBasicSupport);
-                PRINT("Info: vulkan12Features.shaderInt8 %u\n", vulkan12Features.shaderInt8);
-                PRINT("Info: vulkan12Features.bufferDeviceAddress %u\n", vulkan12Features.bufferDeviceAddress);
+        // The layer requires 8-bit integer support, basic subgroup feature in the compute stage and bufferDeviceAddress
+        // feature. Devices without them still get the host decompression entry point, unless the app asked for the
+        // extensions.
+        if (enable_layer && (!computeStageSupport || !subgroupBasicSupport || !vulkan12Features.shaderInt8 ||
+                             !vulkan12Features.bufferDeviceAddress)) {
+            PRINT("Info: computeStageSupport %u\n", computeStageSupport);
+            PRINT("Info: subgroupBasicSupport %u\n", subgroupBasicSupport);
+            PRINT("Info: vulkan12Features.shaderInt8 %u\n", vulkan12Features.shaderInt8);
+            PRINT("Info: vulkan12Features.bufferDeviceAddress %u\n", vulkan12Features.bufferDeviceAddress);
+            if (EnablesDecompressionExtension(pCreateInfo)) {
                 PRINT("Error: Required features not present to use decompression layer.\n");
                 return VK_ERROR_FEATURE_NOT_PRESENT;
             }
+            PRINT("Warning: Required features not present to use decompression layer, only host decompression is available.\n");
+            enable_layer = false;
+        }
+
+        bool instrumentation = enable_layer && instance_data->layer_settings.instrumentation;
+        if (instrumentation && !props.properties.limits.timestampComputeAndGraphics) {
+            PRINT("Warning: Instrumentation needs timestampComputeAndGraphics, disabling it\n");
+            instrumentation = false;
+        }
 
+        // Filter out our extension name and feature struct, in a copy of the create info.
+        // Only enable device hooks if memory decompression extension is enabled AND
+        // the physical device doesn't support it already or we are force enabled.
+        if (enable_layer) {
             vku::safe_VkDeviceCreateInfo create_info(pCreateInfo);
             vku::RemoveExtension(create_info, VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME);
+            vku::RemoveExtension(create_info, VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME);
             vku::RemoveFromPnext(create_info, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_NV);
 
             result = create_device(physicalDevice, create_info.ptr(), pAllocator, pDevice);
@@ -796,8 +1287,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, con
         }
         auto alloccb = pAllocator ? pAllocator : instance_data->allocator;
         auto device_data = std::make_shared<DeviceData>(*pDevice, gdpa, features, enable_layer, alloccb);
+        device_data->streamFormat = instance_data->layer_settings.gdeflate_stream_format;
 
         if (enable_layer) {
+            device_data->shaderSimdWidth = instance_data->layer_settings.shader_simd_width;
+            device_data->shaderInt16 = instance_data->layer_settings.shader_int16;
+            device_data->shaderInt64 = instance_data->layer_settings.shader_int64;
+            device_data->pipelineCachePath = instance_data->layer_settings.pipeline_cache_path;
+            device_data->tuningFile = instance_data->layer_settings.tuning_file;
+            device_data->huffmanLut = instance_data->layer_settings.huffman_lut;
+            device_data->batchCommands = instance_data->layer_settings.batch_commands;
+            device_data->instrumentation = instrumentation;
+            device_data->instrumentationFile = instance_data->layer_settings.instrumentation_file;
+            device_data->instrumentationPeriod = instance_data->layer_settings.instrumentation_period;
             result = device_data->CreatePipelineState(pDevice, physicalDevice);
             if (result != VK_SUCCESS) {
                 PRINT("Error: CreatePipelineState failed with error %u\n", result);
@@ -810,14 +1312,39 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, con
     return result;
 }
 
+// Only rewrites the file when the driver added something, a cache hit leaves it untouched
+void DeviceData::StorePipelineCache() {
+    if (pipelineCache == VK_NULL_HANDLE) {
+        return;
+    }
+    size_t cacheSize = 0;
+    std::vector<uint8_t> cacheData;
+    if (vtable.GetPipelineCacheData(device, pipelineCache, &cacheSize, nullptr) == VK_SUCCESS) {
+        cacheData.resize(cacheSize);
+        if (vtable.GetPipelineCacheData(device, pipelineCache, &cacheSize, cacheData.data()) != VK_SUCCESS) {
+            cacheSize = 0;
+        }
+        cacheData.resize(cacheSize);
+    }
+    if (cacheSize != 0 && cacheData != initialPipelineCacheData) {
+        if (WritePipelineCacheFile(pipelineCacheFile, cacheData)) {
+            PRINT("Info: Stored %zu bytes of pipeline cache to %s\n", cacheSize, pipelineCacheFile.c_str());
+        } else {
+            PRINT("Warning: Could not write the pipeline cache to %s\n", pipelineCacheFile.c_str());
+        }
+    }
+}
+
 void DeviceData::DestroyPipelineState() {
+    pipelineDecompressSingle.Join();
+    pipelineDecompressMulti.Join();
+
     vtable.DestroyPipelineLayout(device, pipelineLayoutDecompressSingle, 0);
     vtable.DestroyPipelineLayout(device, pipelineLayoutDecompressMulti, 0);
-    vtable.DestroyPipelineLayout(device, pipelineLayoutCopy, 0);
 
-    vtable.DestroyPipeline(device, pipelineDecompressMulti, 0);
-    vtable.DestroyPipeline(device, pipelineDecompressSingle, 0);
-    vtable.DestroyPipeline(device, pipelineCopy, 0);
+    vtable.DestroyPipeline(device, pipelineDecompressMulti.Get(), 0);
+    vtable.DestroyPipeline(device, pipelineDecompressSingle.Get(), 0);
+    vtable.DestroyPipelineCache(device, pipelineCache, 0);
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
@@ -826,14 +1353,19 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     if (result != device_data_map.end()) {
         auto device_data = result->second;
 
-        device_data->DestroyPipelineState();
-        device_data->vtable.DestroyBuffer(device, device_data->indirectDispatchBuffer, pAllocator);
-        if (device_data->indirectDispatchBufferMemory) {
-            device_data->vtable.FreeMemory(device, device_data->indirectDispatchBufferMemory, pAllocator);
+        for (auto& entry : device_data->command_buffer_map.snapshot()) {
+            device_data->ReleaseCommandBufferResources(*entry.second);
         }
+        device_data->upload_pool.Destroy();
+        if (device_data->instrumentation) {
+            device_data->timestamp_pools.Destroy();
+            device_data->DumpStatistics(true);
+        }
+        device_data->DestroyPipelineState();
         device_data->vtable.DestroyDevice(device, pAllocator);
 
         device_data_map.erase(key);
+        InvalidateCommandBufferCaches();
     }
 }
 
@@ -861,22 +1393,486 @@ static VkPipelineStageFlags ConvertPipelineStageMask(VkPipelineStageFlags2KHR st
     return result_stage_mask;
 }
 
+// VK_EXT_memory_decompression adds a pipeline stage and accesses for decompressions, which a driver without the extension
+// does not know. Decompressions are compute dispatches that access memory through buffer device addresses, so they are
+// given the compute shader stage and storage accesses instead.
+static void ConvertDecompressionStageAndAccess(VkPipelineStageFlags2& stages, VkAccessFlags2& access) {
+    if (stages & VK_PIPELINE_STAGE_2_MEMORY_DECOMPRESSION_BIT_EXT) {
+        stages = (stages & ~VK_PIPELINE_STAGE_2_MEMORY_DECOMPRESSION_BIT_EXT) | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+    }
+    if (access & VK_ACCESS_2_MEMORY_DECOMPRESSION_READ_BIT_EXT) {
+        access = (access & ~VK_ACCESS_2_MEMORY_DECOMPRESSION_READ_BIT_EXT) | VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+    }
+    if (access & VK_ACCESS_2_MEMORY_DECOMPRESSION_WRITE_BIT_EXT) {
+        access = (access & ~VK_ACCESS_2_MEMORY_DECOMPRESSION_WRITE_BIT_EXT) | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+    }
+}
+
+// Converts the decompression stage and accesses of a scope. Indirect decompressions read their commands in the compute
+// shader too, so second scopes that make indirect commands visible also make them visible to the compute shader, which
+// is logically later than DRAW_INDIRECT and so already waits for the same work. Returns true if the scope changed.
+static bool ConvertDecompressionScope(VkPipelineStageFlags2& stages, VkAccessFlags2& access, SynchronizationScope scope) {
+    const VkPipelineStageFlags2 old_stages = stages;
+    const VkAccessFlags2 old_access = access;
+    ConvertDecompressionStageAndAccess(stages, access);
+    if (scope == SynchronizationScope::kSecond && (access & VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT) &&
+        (stages & (VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT))) {
+        stages |= VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        access |= VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+    }
+    return stages != old_stages || access != old_access;
+}
+
+template <typename Barrier>
+static bool ConvertBarrierScopes(Barrier& barrier) {
+    const bool first = ConvertDecompressionScope(barrier.srcStageMask, barrier.srcAccessMask, SynchronizationScope::kFirst);
+    const bool second = ConvertDecompressionScope(barrier.dstStageMask, barrier.dstAccessMask, SynchronizationScope::kSecond);
+    return first || second;
+}
+
+static bool NamesDecompressionScope(const VkDependencyInfo& info) {
+    auto converts = [](auto barrier) { return ConvertBarrierScopes(barrier); };
+    return std::any_of(info.pMemoryBarriers, info.pMemoryBarriers + info.memoryBarrierCount, converts) ||
+           std::any_of(info.pBufferMemoryBarriers, info.pBufferMemoryBarriers + info.bufferMemoryBarrierCount, converts) ||
+           std::any_of(info.pImageMemoryBarriers, info.pImageMemoryBarriers + info.imageMemoryBarrierCount, converts);
+}
+
+// The app's dependency infos, or converted copies of them if any barrier needs it. Most barriers pass through without
+// being copied.
+struct DecompressionDependencyInfos {
+    DecompressionDependencyInfos(uint32_t count, const VkDependencyInfo* pDependencyInfos) : infos(pDependencyInfos) {
+        if (std::none_of(pDependencyInfos, pDependencyInfos + count, NamesDecompressionScope)) {
+            return;
+        }
+        copies.reserve(count);
+        converted.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            copies.emplace_back(&pDependencyInfos[i]);
+            auto& copy = copies.back();
+            std::for_each(copy.pMemoryBarriers, copy.pMemoryBarriers + copy.memoryBarrierCount,
+                          ConvertBarrierScopes<vku::safe_VkMemoryBarrier2>);
+            std::for_each(copy.pBufferMemoryBarriers, copy.pBufferMemoryBarriers + copy.bufferMemoryBarrierCount,
+                          ConvertBarrierScopes<vku::safe_VkBufferMemoryBarrier2>);
+            std::for_each(copy.pImageMemoryBarriers, copy.pImageMemoryBarriers + copy.imageMemoryBarrierCount,
+                          ConvertBarrierScopes<vku::safe_VkImageMemoryBarrier2>);
+            converted.push_back(*copy.ptr());
+        }
+        infos = converted.data();
+    }
+
+    const VkDependencyInfo* infos;
+    std::vector<vku::safe_VkDependencyInfo> copies;
+    std::vector<VkDependencyInfo> converted;
+};
+
+// Synchronization 1 cannot name the decompression scopes, but barriers making indirect commands visible to DRAW_INDIRECT
+// must also make them visible to the indirect decompression shader. A global barrier is added for it, the app's own are
+// passed through.
+static bool AddIndirectCommandBarrier(VkPipelineStageFlags& dstStageMask, uint32_t memoryBarrierCount,
+                                      const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount,
+                                      const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                      std::vector<VkMemoryBarrier>& memoryBarriers) {
+    if ((dstStageMask & (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT)) == 0) {
+        return false;
+    }
+    VkAccessFlags srcAccessMask = 0;
+    bool indirect = false;
+    for (uint32_t i = 0; i < memoryBarrierCount; i++) {
+        if (pMemoryBarriers[i].dstAccessMask & VK_ACCESS_INDIRECT_COMMAND_READ_BIT) {
+            srcAccessMask |= pMemoryBarriers[i].srcAccessMask;
+            indirect = true;
+        }
+    }
+    for (uint32_t i = 0; i < bufferMemoryBarrierCount; i++) {
+        if (pBufferMemoryBarriers[i].dstAccessMask & VK_ACCESS_INDIRECT_COMMAND_READ_BIT) {
+            srcAccessMask |= pBufferMemoryBarriers[i].srcAccessMask;
+            indirect = true;
+        }
+    }
+    if (!indirect) {
+        return false;
+    }
+    memoryBarriers.assign(pMemoryBarriers, pMemoryBarriers + memoryBarrierCount);
+    VkMemoryBarrier barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    barrier.srcAccessMask = srcAccessMask;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    memoryBarriers.push_back(barrier);
+    dstStageMask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    return true;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                      VkCommandBuffer* pCommandBuffers) {
+    auto device_data = GetDeviceData(device);
+    VkResult result = device_data->vtable.AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    if (result == VK_SUCCESS) {
+        for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
+            auto cb_data = std::make_shared<CommandBufferData>();
+            cb_data->pool = pAllocateInfo->commandPool;
+            device_data->command_buffer_map.insert_or_assign(pCommandBuffers[i], cb_data);
+        }
+    }
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                              const VkCommandBuffer* pCommandBuffers) {
+    auto device_data = GetDeviceData(device);
+    for (uint32_t i = 0; i < commandBufferCount; i++) {
+        auto cb_data = device_data->command_buffer_map.pop(pCommandBuffers[i]);
+        if (cb_data != device_data->command_buffer_map.end()) {
+            device_data->ReleaseCommandBufferResources(*cb_data->second);
+        }
+    }
+    InvalidateCommandBufferCaches();
+    device_data->vtable.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    // Beginning a command buffer implicitly resets it
+    device_data->ReleaseCommandBufferResources(*device_data->GetCommandBufferData(commandBuffer));
+    return device_data->vtable.BeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    auto device_data = GetDeviceData(commandBuffer);
+    device_data->ReleaseCommandBufferResources(*device_data->GetCommandBufferData(commandBuffer));
+    return device_data->vtable.ResetCommandBuffer(commandBuffer, flags);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    auto device_data = GetDeviceData(device);
+    auto pool_command_buffers = device_data->command_buffer_map.snapshot(
+        [commandPool](const std::shared_ptr<CommandBufferData>& cb_data) { return cb_data->pool == commandPool; });
+    for (auto& entry : pool_command_buffers) {
+        device_data->ReleaseCommandBufferResources(*entry.second);
+    }
+    return device_data->vtable.ResetCommandPool(device, commandPool, flags);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
+    auto device_data = GetDeviceData(device);
+    auto pool_command_buffers = device_data->command_buffer_map.snapshot(
+        [commandPool](const std::shared_ptr<CommandBufferData>& cb_data) { return cb_data->pool == commandPool; });
+    for (auto& entry : pool_command_buffers) {
+        device_data->ReleaseCommandBufferResources(*entry.second);
+        device_data->command_buffer_map.erase(entry.first);
+    }
+    InvalidateCommandBufferCaches();
+    device_data->vtable.DestroyCommandPool(device, commandPool, pAllocator);
+}
+
+// Number of workgroups dispatched for indirect decompression, enough to fill current GPUs. Workgroups loop over the
+// commands, and the ones left without a command exit right away.
+static constexpr uint32_t kIndirectDecompressGridSize = 1024;
+
+// Size of the data a GDeflate tile decompresses to, all tiles of a stream but the last one have this size
+static constexpr VkDeviceSize kGDeflateTileSize = 64 * 1024;
+
+// Binds a pipeline of the layer unless it is still bound from the previous decompression, and records that the
+// compute state of the app has to be restored
+static void BindLayerPipeline(DeviceData& device_data, VkCommandBuffer commandBuffer, VkPipeline pipeline) {
+    auto cb_data = device_data.GetCommandBufferData(commandBuffer);
+    ComputeState& state = cb_data->compute_state;
+    if (state.bound_pipeline != pipeline) {
+        device_data.vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        state.bound_pipeline = pipeline;
+    }
+    // The push constants the layer is about to record replace those of the app
+    if (!state.replaced &&
+        (state.app_pipeline != VK_NULL_HANDLE || state.app_shader != VK_NULL_HANDLE || state.push_constant_end != 0)) {
+        state.replaced = true;
+        device_data.replacedComputeStates.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Rebinds the compute pipeline and replays the push constants of the app after the layer's dispatches replaced them
+static void RestoreComputeState(DeviceData& device_data, VkCommandBuffer commandBuffer) {
+    if (device_data.replacedComputeStates.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    auto cb_data = device_data.GetCommandBufferData(commandBuffer);
+    ComputeState& state = cb_data->compute_state;
+    if (!state.replaced) {
+        return;
+    }
+    state.replaced = false;
+    device_data.replacedComputeStates.fetch_sub(1, std::memory_order_relaxed);
+    if (state.app_shader != VK_NULL_HANDLE) {
+        const VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        device_data.vtable.CmdBindShadersEXT(commandBuffer, 1, &stage, &state.app_shader);
+        state.bound_pipeline = VK_NULL_HANDLE;
+    } else if (state.app_pipeline != VK_NULL_HANDLE && state.bound_pipeline != state.app_pipeline) {
+        device_data.vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, state.app_pipeline);
+        state.bound_pipeline = state.app_pipeline;
+    }
+    // Bytes pushed to the same stages are replayed with one push
+    uint32_t offset = 0;
+    while (offset < state.push_constant_end) {
+        const VkShaderStageFlags stages = state.push_constant_stages[offset];
+        uint32_t end = offset + 1;
+        while (end < state.push_constant_end && state.push_constant_stages[end] == stages) {
+            end++;
+        }
+        if (stages != 0) {
+            device_data.vtable.CmdPushConstants(commandBuffer, state.push_constant_layout, stages, offset, end - offset,
+                                                state.push_constant_values.data() + offset);
+        }
+        offset = end;
+    }
+}
+
+// Waits for the multi region pipeline if it is still being built and binds it, false if it could not be built
+static bool BindDecompressMultiPipeline(DeviceData& device_data, VkCommandBuffer commandBuffer) {
+    const VkPipeline pipeline = device_data.pipelineDecompressMulti.Get();
+    if (pipeline == VK_NULL_HANDLE) {
+        PRINT("Error: The multi region decompression pipeline could not be built\n");
+        return false;
+    }
+    BindLayerPipeline(device_data, commandBuffer, pipeline);
+    return true;
+}
+
+// Writes timestamps around the dispatches recorded during its lifetime when instrumentation is enabled. The sample keeps
+// the sizes of the regions, indirect commands are read by the GPU and only counted as dispatches.
+struct ScopedDispatchTimestamps {
+    ScopedDispatchTimestamps(DeviceData& device_data, VkCommandBuffer commandBuffer, uint32_t regionCount = 0,
+                             VkDecompressMemoryRegionEXT const* pRegions = nullptr)
+        : device_data_(device_data), command_buffer_(commandBuffer) {
+        if (!device_data.instrumentation) {
+            return;
+        }
+        cb_data_ = device_data.GetCommandBufferData(commandBuffer);
+        TimestampRing& ring = cb_data_->timestamps;
+        if (ring.pools.empty() || ring.next_query + 2 > TimestampQueryPools::kQueryCount) {
+            VkQueryPool pool;
+            VkResult result = device_data.timestamp_pools.Acquire(&pool);
+            if (result != VK_SUCCESS) {
+                PRINT("Warning: Could not create a timestamp query pool (error %d), the dispatch is not timed\n", result);
+                cb_data_ = nullptr;
+                return;
+            }
+            ring.pools.push_back(pool);
+            ring.next_query = 0;
+        }
+        sample_.pool = ring.pools.back();
+        sample_.query = ring.next_query;
+        sample_.region_count = regionCount;
+        for (uint32_t i = 0; i < regionCount; i++) {
+            sample_.compressed_size += pRegions[i].compressedSize;
+            sample_.decompressed_size += pRegions[i].decompressedSize;
+        }
+        ring.next_query += 2;
+        // The command buffer may be submitted again, so the queries are reset on the device each time they are written.
+        // Decompression is recorded outside render passes, where resetting queries is allowed.
+        device_data.vtable.CmdResetQueryPool(commandBuffer, sample_.pool, sample_.query, 2);
+        device_data.vtable.CmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, sample_.pool, sample_.query);
+    }
+
+    ~ScopedDispatchTimestamps() {
+        if (cb_data_ == nullptr) {
+            return;
+        }
+        device_data_.vtable.CmdWriteTimestamp(command_buffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, sample_.pool,
+                                              sample_.query + 1);
+        cb_data_->timestamps.samples.push_back(sample_);
+    }
+
+  private:
+    DeviceData& device_data_;
+    VkCommandBuffer command_buffer_;
+    CommandBufferData* cb_data_ = nullptr;
+    TimestampSample sample_;
+};
+
+static void CmdDecompressMemorySingle(DeviceData& device_data, VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
+                                      VkDecompressMemoryRegionEXT const* pDecompressMemoryRegions) {
+    const VkPipeline pipeline = device_data.pipelineDecompressSingle.Get();
+    if (pipeline == VK_NULL_HANDLE) {
+        PRINT("Error: The single region decompression pipeline could not be built\n");
+        return;
+    }
+    BindLayerPipeline(device_data, commandBuffer, pipeline);
+    for (uint32_t t = 0; t < decompressRegionCount; t++) {
+        device_data.vtable.CmdPushConstants(commandBuffer, device_data.pipelineLayoutDecompressSingle, VK_SHADER_STAGE_COMPUTE_BIT,
+                                            0, sizeof(VkDecompressMemoryRegionEXT), (void*)&pDecompressMemoryRegions[t]);
+        device_data.vtable.CmdDispatch(commandBuffer, 1, 1, 1);
+    }
+}
+
+// Regions of both extensions are recorded as VkDecompressMemoryRegionEXT, the shaders do not read the method of NV regions
+static VkDecompressMemoryRegionEXT ToRegionEXT(const VkDecompressMemoryRegionNV& region) {
+    return {region.srcAddress, region.dstAddress, region.compressedSize, region.decompressedSize};
+}
+
+static void RecordDecompressMemory(DeviceData& device_data, VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
+                                   VkDecompressMemoryRegionEXT const* pDecompressMemoryRegions) {
+    ScopedDispatchTimestamps timestamps(device_data, commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+
+    // A single region is passed through push constants, no need to upload anything
+    if (decompressRegionCount == 1 && !device_data.streamFormat) {
+        CmdDecompressMemorySingle(device_data, commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+        return;
+    }
+
+    auto cb_data = device_data.GetCommandBufferData(commandBuffer);
+    if (device_data.streamFormat) {
+        // Tiles of all streams are spread over the workgroups of a single dispatch, which reads the region count
+        // from memory like an indirect decompression does.
+        const VkDeviceSize count_size = 16;
+        const VkDeviceSize upload_size = count_size + sizeof(VkDecompressMemoryRegionEXT) * decompressRegionCount;
+        TransientAllocation upload;
+        VkResult result = device_data.AllocateTransient(cb_data->upload_ring, upload_size, 16, &upload);
+        if (result != VK_SUCCESS) {
+            PRINT("Error: Could not allocate %llu bytes of transient memory (error %d)\n", (unsigned long long)upload_size,
+                  result);
+            return;
+        }
+        VkDeviceSize tile_count = 0;
+        for (uint32_t i = 0; i < decompressRegionCount; i++) {
+            tile_count += (pDecompressMemoryRegions[i].decompressedSize + kGDeflateTileSize - 1) / kGDeflateTileSize;
+        }
+        memcpy(upload.mapped, &decompressRegionCount, sizeof(decompressRegionCount));
+        memcpy(static_cast<uint8_t*>(upload.mapped) + count_size, pDecompressMemoryRegions,
+               sizeof(VkDecompressMemoryRegionEXT) * decompressRegionCount);
+
+        const VkDeviceSize max_grid_size = device_data.maxComputeWorkGroupCountX;
+        const uint32_t gridSize = static_cast<uint32_t>(std::min(std::max<VkDeviceSize>(tile_count, 1), max_grid_size));
+        DeviceData::PushConstantDataDecompressMulti pushConstantData = {
+            upload.address + count_size, sizeof(VkDecompressMemoryRegionEXT), decompressRegionCount, upload.address};
+        if (!BindDecompressMultiPipeline(device_data, commandBuffer)) {
+            return;
+        }
+        device_data.vtable.CmdPushConstants(commandBuffer, device_data.pipelineLayoutDecompressMulti, VK_SHADER_STAGE_COMPUTE_BIT,
+                                            0, sizeof(DeviceData::PushConstantDataDecompressMulti), &pushConstantData);
+        device_data.vtable.CmdDispatch(commandBuffer, gridSize, 1, 1);
+        return;
+    }
+
+    // Upload the region array and let the multi-region shader decompress one region per workgroup
+    const VkDeviceSize regions_size = sizeof(VkDecompressMemoryRegionEXT) * decompressRegionCount;
+    TransientAllocation regions;
+    VkResult result = device_data.AllocateTransient(cb_data->upload_ring, regions_size, 16, &regions);
+    if (result != VK_SUCCESS) {
+        PRINT("Warning: Could not allocate %llu bytes of transient memory (error %d), decompressing regions one at a time\n",
+              (unsigned long long)regions_size, result);
+        CmdDecompressMemorySingle(device_data, commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+        return;
+    }
+    memcpy(regions.mapped, pDecompressMemoryRegions, static_cast<size_t>(regions_size));
+
+    if (!BindDecompressMultiPipeline(device_data, commandBuffer)) {
+        return;
+    }
+    // Split the dispatch if there are more regions than workgroups allowed in a single dispatch
+    for (uint32_t first = 0; first < decompressRegionCount; first += device_data.maxComputeWorkGroupCountX) {
+        const uint32_t count = std::min(decompressRegionCount - first, device_data.maxComputeWorkGroupCountX);
+        DeviceData::PushConstantDataDecompressMulti pushConstantData = {
+            regions.address + first * sizeof(VkDecompressMemoryRegionEXT), sizeof(VkDecompressMemoryRegionEXT), count, 0};
+        device_data.vtable.CmdPushConstants(commandBuffer, device_data.pipelineLayoutDecompressMulti, VK_SHADER_STAGE_COMPUTE_BIT,
+                                            0, sizeof(DeviceData::PushConstantDataDecompressMulti), &pushConstantData);
+        device_data.vtable.CmdDispatch(commandBuffer, count, 1, 1);
+    }
+}
+
+// Records the decompressions batched in a command buffer. Commands recorded without a barrier in between are not ordered
+// with each other, so the batch only has to be recorded before the commands that synchronize with it, observe it, or end
+// the command buffer. The compute state it replaces is restored before the app uses it.
+static void FlushDecompressBatch(DeviceData& device_data, VkCommandBuffer commandBuffer) {
+    if (device_data.batchedCommandBuffers.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    auto cb_data = device_data.GetCommandBufferData(commandBuffer);
+    if (cb_data->batched_regions.empty()) {
+        return;
+    }
+    std::vector<VkDecompressMemoryRegionEXT> regions;
+    regions.swap(cb_data->batched_regions);
+    device_data.batchedCommandBuffers.fetch_sub(1, std::memory_order_relaxed);
+    RecordDecompressMemory(device_data, commandBuffer, VecSize(regions), regions.data());
+    // Hand the storage back for the next batch
+    regions.clear();
+    cb_data->batched_regions.swap(regions);
+}
+
+// Appends the regions to the batch of the command buffer, FlushDecompressBatch dispatches them with the regions of the
+// calls recorded before and after
+static std::vector<VkDecompressMemoryRegionEXT>& BatchRegions(DeviceData& device_data, VkCommandBuffer commandBuffer) {
+    auto cb_data = device_data.GetCommandBufferData(commandBuffer);
+    if (cb_data->batched_regions.empty()) {
+        device_data.batchedCommandBuffers.fetch_add(1, std::memory_order_relaxed);
+    }
+    return cb_data->batched_regions;
+}
+
 VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
                                                  VkDecompressMemoryRegionNV const* pDecompressMemoryRegions) {
     auto device_data = GetDeviceData(commandBuffer);
 
     if (device_data->vtable.CmdDecompressMemoryNV) {
         device_data->vtable.CmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
-    } else {
-        device_data->vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, device_data->pipelineDecompressSingle);
-        for (uint32_t t = 0; t < decompressRegionCount; t++) {
-            device_data->vtable.CmdPushConstants(commandBuffer, device_data->pipelineLayoutDecompressSingle,
-                                                 VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(VkDecompressMemoryRegionNV),
-                                                 (void*)&pDecompressMemoryRegions[t]);
-            device_data->vtable.CmdDispatch(commandBuffer, 1, 1, 1);
-            PRINT("Info: vkCmdDecompressMemoryNV: Using VK_LAYER_KHRONOS_memory_decompression layer\n");
-        }
+        return;
+    }
+    if (decompressRegionCount == 0) {
+        return;
+    }
+    PRINT("Info: vkCmdDecompressMemoryNV: Using VK_LAYER_KHRONOS_memory_decompression layer\n");
+
+    if (!device_data->batchCommands) {
+        std::vector<VkDecompressMemoryRegionEXT> regions(decompressRegionCount);
+        std::transform(pDecompressMemoryRegions, pDecompressMemoryRegions + decompressRegionCount, regions.begin(), ToRegionEXT);
+        RecordDecompressMemory(*device_data, commandBuffer, decompressRegionCount, regions.data());
+        return;
+    }
+    auto& batch = BatchRegions(*device_data, commandBuffer);
+    std::transform(pDecompressMemoryRegions, pDecompressMemoryRegions + decompressRegionCount, std::back_inserter(batch),
+                   ToRegionEXT);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryEXT(VkCommandBuffer commandBuffer,
+                                                  const VkDecompressMemoryInfoEXT* pDecompressMemoryInfoEXT) {
+    auto device_data = GetDeviceData(commandBuffer);
+
+    if (device_data->vtable.CmdDecompressMemoryEXT) {
+        device_data->vtable.CmdDecompressMemoryEXT(commandBuffer, pDecompressMemoryInfoEXT);
+        return;
+    }
+    const uint32_t regionCount = pDecompressMemoryInfoEXT->regionCount;
+    if (regionCount == 0) {
+        return;
+    }
+    if (pDecompressMemoryInfoEXT->decompressionMethod != VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT) {
+        PRINT("Error: vkCmdDecompressMemoryEXT: Unsupported decompression method 0x%llx\n",
+              (unsigned long long)pDecompressMemoryInfoEXT->decompressionMethod);
+        return;
+    }
+    PRINT("Info: vkCmdDecompressMemoryEXT: Using VK_LAYER_KHRONOS_memory_decompression layer\n");
+
+    // The regions already have the layout the multi region shader reads, so they are uploaded as they are
+    if (!device_data->batchCommands) {
+        RecordDecompressMemory(*device_data, commandBuffer, regionCount, pDecompressMemoryInfoEXT->pRegions);
+        return;
+    }
+    auto& batch = BatchRegions(*device_data, commandBuffer);
+    batch.insert(batch.end(), pDecompressMemoryInfoEXT->pRegions, pDecompressMemoryInfoEXT->pRegions + regionCount);
+}
+
+// The indirect kernel reads the command count itself and loops over the commands, so a fixed grid is dispatched instead
+// of copying the count into dispatch arguments, which would need a barrier before the indirect dispatch.
+static void RecordDecompressMemoryIndirect(DeviceData& device_data, VkCommandBuffer commandBuffer,
+                                           VkDeviceAddress indirectCommandsAddress, VkDeviceAddress indirectCommandsCountAddress,
+                                           uint32_t maxCount, uint32_t stride) {
+    const uint32_t gridSize = std::min(kIndirectDecompressGridSize, device_data.maxComputeWorkGroupCountX);
+    DeviceData::PushConstantDataDecompressMulti pushConstantData = {indirectCommandsAddress, stride, maxCount,
+                                                                    indirectCommandsCountAddress};
+    if (!BindDecompressMultiPipeline(device_data, commandBuffer)) {
+        return;
     }
+    ScopedDispatchTimestamps timestamps(device_data, commandBuffer);
+    device_data.vtable.CmdPushConstants(commandBuffer, device_data.pipelineLayoutDecompressMulti, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                        sizeof(DeviceData::PushConstantDataDecompressMulti), &pushConstantData);
+    device_data.vtable.CmdDispatch(commandBuffer, gridSize, 1, 1);
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer commandBuffer,
@@ -887,33 +1883,31 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
         device_data->vtable.CmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
                                                                stride);
     } else {
-        DeviceData::PushConstantDataCopy pushConstantDataCopy = {indirectCommandsCountAddress,
-                                                                 device_data->indirectDispatchBufferAddress};
-        device_data->vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, device_data->pipelineCopy);
-        device_data->vtable.CmdPushConstants(commandBuffer, device_data->pipelineLayoutCopy, VK_SHADER_STAGE_COMPUTE_BIT, 0,
-                                             sizeof(DeviceData::PushConstantDataCopy), &pushConstantDataCopy);
-        device_data->vtable.CmdDispatch(commandBuffer, 1, 1, 1);
-
-        DeviceData::PushConstantDataDecompressMulti pushConstantData = {indirectCommandsAddress, stride};
-        {
-            VkBufferMemoryBarrier bufferBarrier = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER};
-            bufferBarrier.buffer = device_data->indirectDispatchBuffer;
-            bufferBarrier.offset = 0;
-            bufferBarrier.size = VK_WHOLE_SIZE;
-            bufferBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-            bufferBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
-            device_data->vtable.CmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-                                                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, 0, 1, &bufferBarrier, 0, 0);
-        }
-
-        device_data->vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, device_data->pipelineDecompressMulti);
-        device_data->vtable.CmdPushConstants(commandBuffer, device_data->pipelineLayoutDecompressMulti, VK_SHADER_STAGE_COMPUTE_BIT,
-                                             0, sizeof(DeviceData::PushConstantDataDecompressMulti), &pushConstantData);
-        device_data->vtable.CmdDispatchIndirect(commandBuffer, device_data->indirectDispatchBuffer, 0);
+        RecordDecompressMemoryIndirect(*device_data, commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
+                                       UINT32_MAX, stride);
         PRINT("Info: vkCmdDecompressMemoryIndirectCountNV: Using VK_LAYER_KHRONOS_memory_decompression layer\n");
     }
 }
 
+VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountEXT(VkCommandBuffer commandBuffer,
+                                                               VkMemoryDecompressionMethodFlagsEXT decompressionMethod,
+                                                               VkDeviceAddress indirectCommandsAddress,
+                                                               VkDeviceAddress indirectCommandsCountAddress,
+                                                               uint32_t maxDecompressionCount, uint32_t stride) {
+    auto device_data = GetDeviceData(commandBuffer);
+    if (device_data->vtable.CmdDecompressMemoryIndirectCountEXT) {
+        device_data->vtable.CmdDecompressMemoryIndirectCountEXT(commandBuffer, decompressionMethod, indirectCommandsAddress,
+                                                                indirectCommandsCountAddress, maxDecompressionCount, stride);
+    } else if (decompressionMethod != VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT) {
+        PRINT("Error: vkCmdDecompressMemoryIndirectCountEXT: Unsupported decompression method 0x%llx\n",
+              (unsigned long long)decompressionMethod);
+    } else {
+        RecordDecompressMemoryIndirect(*device_data, commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
+                                       maxDecompressionCount, stride);
+        PRINT("Info: vkCmdDecompressMemoryIndirectCountEXT: Using VK_LAYER_KHRONOS_memory_decompression layer\n");
+    }
+}
+
 VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
                                               VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
                                               uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
@@ -922,12 +1916,346 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     auto device_data = GetDeviceData(commandBuffer);
     const auto& features = device_data->features;
 
+    FlushDecompressBatch(*device_data, commandBuffer);
+    std::vector<VkMemoryBarrier> memoryBarriers;
+    if (AddIndirectCommandBarrier(dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                  pBufferMemoryBarriers, memoryBarriers)) {
+        memoryBarrierCount = VecSize(memoryBarriers);
+        pMemoryBarriers = memoryBarriers.data();
+    }
     device_data->vtable.CmdPipelineBarrier(
         commandBuffer, ConvertPipelineStageMask(srcStageMask, SynchronizationScope::kFirst, features),
         ConvertPipelineStageMask(dstStageMask, SynchronizationScope::kSecond, features), dependencyFlags, memoryBarrierCount,
         pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
+VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    DecompressionDependencyInfos dependency(1, pDependencyInfo);
+    device_data->vtable.CmdPipelineBarrier2(commandBuffer, dependency.infos);
+}
+
+// The hooks below record the batched decompressions before passing the command down
+
+VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdSetEvent(commandBuffer, event, stageMask);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdResetEvent(commandBuffer, event, stageMask);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    DecompressionDependencyInfos dependency(1, pDependencyInfo);
+    device_data->vtable.CmdSetEvent2(commandBuffer, event, dependency.infos);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    VkAccessFlags2 access = 0;
+    ConvertDecompressionStageAndAccess(stageMask, access);
+    device_data->vtable.CmdResetEvent2(commandBuffer, event, stageMask);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                         VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                         uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                         uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                         uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    std::vector<VkMemoryBarrier> memoryBarriers;
+    if (AddIndirectCommandBarrier(dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                                  pBufferMemoryBarriers, memoryBarriers)) {
+        memoryBarrierCount = VecSize(memoryBarriers);
+        pMemoryBarriers = memoryBarriers.data();
+    }
+    device_data->vtable.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                                      pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                      pImageMemoryBarriers);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                          const VkDependencyInfo* pDependencyInfos) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    DecompressionDependencyInfos dependencies(eventCount, pDependencyInfos);
+    device_data->vtable.CmdWaitEvents2(commandBuffer, eventCount, pEvents, dependencies.infos);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
+                                         VkQueryControlFlags flags) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdEndQuery(commandBuffer, queryPool, query);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
+                                             VkQueryPool queryPool, uint32_t query) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
+                                              uint32_t query) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    VkAccessFlags2 access = 0;
+    ConvertDecompressionStageAndAccess(stage, access);
+    device_data->vtable.CmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+}
+
+// Dispatches are not allowed in render passes, so the batch is recorded before the render pass begins. The app's push
+// constants are restored for its draws.
+VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                              VkSubpassContents contents) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                               const VkSubpassBeginInfo* pSubpassBeginInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdBeginRendering(commandBuffer, pRenderingInfo);
+}
+
+// The state of the primary command buffer is undefined after secondary command buffers executed, the app sets it again
+VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                              const VkCommandBuffer* pCommandBuffers) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    device_data->vtable.CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+
+    auto cb_data = device_data->GetCommandBufferData(commandBuffer);
+    if (cb_data->compute_state.replaced) {
+        device_data->replacedComputeStates.fetch_sub(1, std::memory_order_relaxed);
+    }
+    cb_data->compute_state.Reset();
+}
+
+// The app's compute pipeline and push constants are shadowed, so that they can be restored after the layer's dispatches
+VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                           VkPipeline pipeline) {
+    auto device_data = GetDeviceData(commandBuffer);
+    if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_COMPUTE) {
+        ComputeState& state = device_data->GetCommandBufferData(commandBuffer)->compute_state;
+        state.app_pipeline = pipeline;
+        state.app_shader = VK_NULL_HANDLE;
+        state.bound_pipeline = pipeline;
+    }
+    device_data->vtable.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+// A compute shader object replaces the bound compute pipeline, of the app or of the layer
+VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits* pStages,
+                                             const VkShaderEXT* pShaders) {
+    auto device_data = GetDeviceData(commandBuffer);
+    for (uint32_t i = 0; i < stageCount; i++) {
+        if (pStages[i] == VK_SHADER_STAGE_COMPUTE_BIT) {
+            ComputeState& state = device_data->GetCommandBufferData(commandBuffer)->compute_state;
+            state.app_pipeline = VK_NULL_HANDLE;
+            state.app_shader = pShaders ? pShaders[i] : VK_NULL_HANDLE;
+            state.bound_pipeline = VK_NULL_HANDLE;
+        }
+    }
+    device_data->vtable.CmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
+}
+
+// Pipeline layouts with identical push constant ranges are compatible for push constants, they get the same id of their
+// ranges so that the shadowed constants survive a push through another compatible layout
+VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo,
+                                                    const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+    auto device_data = GetDeviceData(device);
+    VkResult result = device_data->vtable.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+    if (result == VK_SUCCESS) {
+        std::vector<std::tuple<uint32_t, uint32_t, VkShaderStageFlags>> ranges;
+        for (uint32_t i = 0; i < pCreateInfo->pushConstantRangeCount; i++) {
+            const VkPushConstantRange& range = pCreateInfo->pPushConstantRanges[i];
+            ranges.emplace_back(range.offset, range.size, range.stageFlags);
+        }
+        std::sort(ranges.begin(), ranges.end());
+        uint32_t id;
+        {
+            std::lock_guard<std::mutex> lock(device_data->push_constant_ranges_lock);
+            id = device_data->push_constant_ranges_ids.emplace(ranges, VecSize(device_data->push_constant_ranges_ids) + 1)
+                     .first->second;
+        }
+        device_data->pipeline_layout_map.insert_or_assign(*pPipelineLayout, id);
+    }
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
+                                                 const VkAllocationCallbacks* pAllocator) {
+    auto device_data = GetDeviceData(device);
+    device_data->pipeline_layout_map.erase(pipelineLayout);
+    device_data->vtable.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+static void ShadowPushConstants(DeviceData& device_data, ComputeState& state, VkPipelineLayout layout,
+                                VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+    // Constants pushed through a layout with other push constant ranges are not kept
+    if (layout != state.push_constant_layout) {
+        auto result = device_data.pipeline_layout_map.find(layout);
+        const uint32_t ranges = result != device_data.pipeline_layout_map.end() ? result->second : 0;
+        if (ranges == 0 || ranges != state.push_constant_ranges) {
+            state.ClearPushConstants();
+            state.push_constant_ranges = ranges;
+        }
+        state.push_constant_layout = layout;
+    }
+    if (state.push_constant_values.empty()) {
+        state.push_constant_values.resize(device_data.maxPushConstantsSize);
+        state.push_constant_stages.resize(device_data.maxPushConstantsSize);
+    }
+    memcpy(state.push_constant_values.data() + offset, pValues, size);
+    std::fill_n(state.push_constant_stages.begin() + offset, size, stageFlags);
+    state.push_constant_end = std::max(state.push_constant_end, offset + size);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                                            uint32_t offset, uint32_t size, const void* pValues) {
+    auto device_data = GetDeviceData(commandBuffer);
+    ComputeState& state = device_data->GetCommandBufferData(commandBuffer)->compute_state;
+    ShadowPushConstants(*device_data, state, layout, stageFlags, offset, size, pValues);
+    device_data->vtable.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+// Pushes whose layout is given in the pNext chain instead of a handle can't be replayed, they drop the app's constants
+// the layer would restore
+VKAPI_ATTR void VKAPI_CALL CmdPushConstants2(VkCommandBuffer commandBuffer, const VkPushConstantsInfo* pPushConstantsInfo) {
+    auto device_data = GetDeviceData(commandBuffer);
+    ComputeState& state = device_data->GetCommandBufferData(commandBuffer)->compute_state;
+    if (pPushConstantsInfo->layout != VK_NULL_HANDLE) {
+        ShadowPushConstants(*device_data, state, pPushConstantsInfo->layout, pPushConstantsInfo->stageFlags,
+                            pPushConstantsInfo->offset, pPushConstantsInfo->size, pPushConstantsInfo->pValues);
+    } else {
+        state.ClearPushConstants();
+    }
+    device_data->vtable.CmdPushConstants2(commandBuffer, pPushConstantsInfo);
+}
+
+// The app's dispatches run with its own compute state
+VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                       uint32_t groupCountZ) {
+    auto device_data = GetDeviceData(commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    auto device_data = GetDeviceData(commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
+                                           uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    auto device_data = GetDeviceData(commandBuffer);
+    RestoreComputeState(*device_data, commandBuffer);
+    device_data->vtable.CmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                                        groupCountZ);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
+    auto device_data = GetDeviceData(commandBuffer);
+    FlushDecompressBatch(*device_data, commandBuffer);
+    return device_data->vtable.EndCommandBuffer(commandBuffer);
+}
+
+// Semaphore waits and signals can name the decompression stage too
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    auto device_data = GetDeviceData(queue);
+    auto names_decompression = [](const VkSemaphoreSubmitInfo& info) {
+        return (info.stageMask & VK_PIPELINE_STAGE_2_MEMORY_DECOMPRESSION_BIT_EXT) != 0;
+    };
+    auto submit_names_decompression = [&](const VkSubmitInfo2& submit) {
+        return std::any_of(submit.pWaitSemaphoreInfos, submit.pWaitSemaphoreInfos + submit.waitSemaphoreInfoCount,
+                           names_decompression) ||
+               std::any_of(submit.pSignalSemaphoreInfos, submit.pSignalSemaphoreInfos + submit.signalSemaphoreInfoCount,
+                           names_decompression);
+    };
+    if (std::none_of(pSubmits, pSubmits + submitCount, submit_names_decompression)) {
+        return device_data->vtable.QueueSubmit2(queue, submitCount, pSubmits, fence);
+    }
+
+    std::vector<vku::safe_VkSubmitInfo2> copies;
+    std::vector<VkSubmitInfo2> submits;
+    copies.reserve(submitCount);
+    submits.reserve(submitCount);
+    for (uint32_t i = 0; i < submitCount; i++) {
+        copies.emplace_back(&pSubmits[i]);
+        auto& copy = copies.back();
+        VkAccessFlags2 access = 0;
+        for (uint32_t j = 0; j < copy.waitSemaphoreInfoCount; j++) {
+            ConvertDecompressionStageAndAccess(copy.pWaitSemaphoreInfos[j].stageMask, access);
+        }
+        for (uint32_t j = 0; j < copy.signalSemaphoreInfoCount; j++) {
+            ConvertDecompressionStageAndAccess(copy.pSignalSemaphoreInfos[j].stageMask, access);
+        }
+        submits.push_back(*copy.ptr());
+    }
+    return device_data->vtable.QueueSubmit2(queue, submitCount, submits.data(), fence);
+}
+
+// Layer specific entry point declared in decompression_statistics.h
+VKAPI_ATTR VkResult VKAPI_CALL GetMemoryDecompressionStatisticsKHRONOS(VkDevice device,
+                                                                       VkMemoryDecompressionStatisticsKHRONOS* pStatistics) {
+    auto device_data = GetDeviceData(device);
+    if (!device_data->instrumentation) {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+    std::lock_guard<std::mutex> lock(device_data->statisticsLock);
+    *pStatistics = device_data->statistics;
+    return VK_SUCCESS;
+}
+
+// Layer specific entry point declared in decompression_host.h
+VKAPI_ATTR VkResult VKAPI_CALL DecompressMemoryHostKHRONOS(VkDevice device, uint32_t regionCount,
+                                                           const VkDecompressMemoryRegionHostKHRONOS* pRegions) {
+    auto device_data = GetDeviceData(device);
+    std::vector<gdeflate::HostRegion> regions(regionCount);
+    for (uint32_t i = 0; i < regionCount; i++) {
+        const VkDecompressMemoryRegionHostKHRONOS& region = pRegions[i];
+        if (region.decompressionMethod != VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT) {
+            return VK_ERROR_FORMAT_NOT_SUPPORTED;
+        }
+        regions[i] = {static_cast<const uint8_t*>(region.pSrc), static_cast<size_t>(region.compressedSize),
+                      static_cast<uint8_t*>(region.pDst), static_cast<size_t>(region.decompressedSize)};
+    }
+    if (!gdeflate::DecompressRegions(regions.data(), regions.size(), device_data->streamFormat)) {
+        PRINT("Error: DecompressMemoryHostKHRONOS failed to decompress %u regions\n", regionCount);
+        return VK_ERROR_UNKNOWN;
+    }
+    return VK_SUCCESS;
+}
+
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char* pName);
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char* pName);
 
@@ -950,15 +2278,79 @@ static const std::unordered_map<std::string, PFN_vkVoidFunction> kInstanceFuncti
 
 static const std::unordered_map<std::string, PFN_vkVoidFunction> kDeviceFunctions = {
     ADD_HOOK(DestroyDevice),
+    ADD_HOOK(AllocateCommandBuffers),
+    ADD_HOOK(FreeCommandBuffers),
+    ADD_HOOK(BeginCommandBuffer),
+    ADD_HOOK(ResetCommandBuffer),
+    ADD_HOOK(ResetCommandPool),
+    ADD_HOOK(DestroyCommandPool),
+    ADD_HOOK(EndCommandBuffer),
+    ADD_HOOK(CreatePipelineLayout),
+    ADD_HOOK(DestroyPipelineLayout),
+    ADD_HOOK(CmdBindPipeline),
+    ADD_HOOK(CmdPushConstants),
+    ADD_HOOK(CmdDispatch),
+    ADD_HOOK(CmdDispatchIndirect),
     ADD_HOOK(CmdPipelineBarrier),
+    ADD_HOOK(CmdSetEvent),
+    ADD_HOOK(CmdResetEvent),
+    ADD_HOOK(CmdWaitEvents),
+    ADD_HOOK(CmdBeginQuery),
+    ADD_HOOK(CmdEndQuery),
+    ADD_HOOK(CmdWriteTimestamp),
+    ADD_HOOK(CmdBeginRenderPass),
+    ADD_HOOK(CmdExecuteCommands),
     ADD_HOOK(CmdDecompressMemoryNV),
     ADD_HOOK(CmdDecompressMemoryIndirectCountNV),
+    ADD_HOOK(CmdDecompressMemoryEXT),
+    ADD_HOOK(CmdDecompressMemoryIndirectCountEXT),
+    ADD_HOOK(GetMemoryDecompressionStatisticsKHRONOS),
 
     // Needs to point to itself as Android loaders calls vkGet*ProcAddr to itself. Without these hooks, when the app calls
     // vkGetDeviceProcAddr to get layer functions it will fail on Android
     ADD_HOOK(GetInstanceProcAddr),
     ADD_HOOK(GetDeviceProcAddr),
 };
+
+// Device functions that call down to entry points of newer core versions or extensions. They are only returned when the
+// device has the entry point, so that applications still see that it is missing.
+struct OptionalHook {
+    PFN_vkVoidFunction function;
+    bool (*is_supported)(DeviceData const& device_data);
+};
+
+#define ADD_OPTIONAL_HOOK(fn, vtable_fn) \
+    { "vk" #fn, {(PFN_vkVoidFunction)vtable_fn, [](DeviceData const& data) { return data.vtable.vtable_fn != nullptr; }} }
+
+static const std::unordered_map<std::string, OptionalHook> kOptionalDeviceFunctions = {
+    ADD_OPTIONAL_HOOK(CmdPushConstants2, CmdPushConstants2),
+    ADD_OPTIONAL_HOOK(CmdPushConstants2KHR, CmdPushConstants2),
+    ADD_OPTIONAL_HOOK(CmdBindShadersEXT, CmdBindShadersEXT),
+    ADD_OPTIONAL_HOOK(CmdDispatchBase, CmdDispatchBase),
+    ADD_OPTIONAL_HOOK(CmdDispatchBaseKHR, CmdDispatchBase),
+    ADD_OPTIONAL_HOOK(CmdPipelineBarrier2, CmdPipelineBarrier2),
+    ADD_OPTIONAL_HOOK(CmdPipelineBarrier2KHR, CmdPipelineBarrier2),
+    ADD_OPTIONAL_HOOK(CmdSetEvent2, CmdSetEvent2),
+    ADD_OPTIONAL_HOOK(CmdSetEvent2KHR, CmdSetEvent2),
+    ADD_OPTIONAL_HOOK(CmdResetEvent2, CmdResetEvent2),
+    ADD_OPTIONAL_HOOK(CmdResetEvent2KHR, CmdResetEvent2),
+    ADD_OPTIONAL_HOOK(CmdWaitEvents2, CmdWaitEvents2),
+    ADD_OPTIONAL_HOOK(CmdWaitEvents2KHR, CmdWaitEvents2),
+    ADD_OPTIONAL_HOOK(CmdWriteTimestamp2, CmdWriteTimestamp2),
+    ADD_OPTIONAL_HOOK(CmdWriteTimestamp2KHR, CmdWriteTimestamp2),
+    ADD_OPTIONAL_HOOK(CmdBeginRenderPass2, CmdBeginRenderPass2),
+    ADD_OPTIONAL_HOOK(CmdBeginRenderPass2KHR, CmdBeginRenderPass2),
+    ADD_OPTIONAL_HOOK(CmdBeginRendering, CmdBeginRendering),
+    ADD_OPTIONAL_HOOK(CmdBeginRenderingKHR, CmdBeginRendering),
+    ADD_OPTIONAL_HOOK(QueueSubmit2, QueueSubmit2),
+    ADD_OPTIONAL_HOOK(QueueSubmit2KHR, QueueSubmit2),
+};
+#undef ADD_OPTIONAL_HOOK
+
+// Device functions that do not depend on the layer implementing the decompression extensions for the device
+static const std::unordered_map<std::string, PFN_vkVoidFunction> kHostDeviceFunctions = {
+    ADD_HOOK(DecompressMemoryHostKHRONOS),
+};
 #undef ADD_HOOK
 #undef ADD_HOOK_ALIAS
 
@@ -971,6 +2363,14 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
     if (dev_result != kDeviceFunctions.end()) {
         return dev_result->second;
     }
+    auto optional_result = kOptionalDeviceFunctions.find(pName);
+    if (optional_result != kOptionalDeviceFunctions.end()) {
+        return optional_result->second.function;
+    }
+    auto host_result = kHostDeviceFunctions.find(pName);
+    if (host_result != kHostDeviceFunctions.end()) {
+        return host_result->second;
+    }
     auto instance_data = GetInstanceData(instance);
     if (instance_data != nullptr && instance_data->vtable.GetInstanceProcAddr) {
         PFN_vkVoidFunction result = instance_data->vtable.GetInstanceProcAddr(instance, pName);
@@ -986,6 +2386,16 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
         if (result != kDeviceFunctions.end()) {
             return result->second;
         }
+        auto optional_result = kOptionalDeviceFunctions.find(pName);
+        if (optional_result != kOptionalDeviceFunctions.end()) {
+            return optional_result->second.is_supported(*device_data) ? optional_result->second.function : nullptr;
+        }
+    }
+    if (device_data) {
+        auto result = kHostDeviceFunctions.find(pName);
+        if (result != kHostDeviceFunctions.end()) {
+            return result->second;
+        }
     }
     if (device_data && device_data->vtable.GetDeviceProcAddr) {
         PFN_vkVoidFunction result = device_data->vtable.GetDeviceProcAddr(device, pName);
@@ -18,14 +18,22 @@
 #define VK_NO_PROTOTYPES
 #include <vulkan/vulkan_core.h>
 #undef VK_NO_PROTOTYPES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 #include <unordered_set>
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
 
-struct ByteCode {
-    const uint8_t* code;
-    size_t size;
-};
+#include "decompression_host.h"
+#include "decompression_statistics.h"
 
 namespace memory_decompression {
 enum class SynchronizationScope { kFirst, kSecond };
@@ -36,6 +44,17 @@ struct DeviceFeatures;
 struct LayerSettings {
     bool force_enable{false};
     bool logging{false};
+    bool gdeflate_stream_format{false};
+    uint32_t shader_simd_width{0};
+    bool shader_int16{true};
+    bool shader_int64{true};
+    std::string pipeline_cache_path;
+    std::string tuning_file;
+    bool huffman_lut{false};
+    bool batch_commands{true};
+    bool instrumentation{false};
+    std::string instrumentation_file;
+    uint32_t instrumentation_period{1000};
 };
 
 template <typename T>
@@ -97,12 +116,146 @@ struct InstanceData {
     vku::concurrent::unordered_map<VkPhysicalDevice, std::shared_ptr<PhysicalDeviceData>> physical_device_map;
 };
 
+// Persistently mapped, device-addressable buffer that command buffers suballocate per-call data from
+struct TransientBlock {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceAddress address = 0;
+    uint8_t* mapped = nullptr;
+    VkDeviceSize size = 0;
+};
+
+// Suballocation of a TransientBlock, valid until the command buffer it was made for is reset or freed
+struct TransientAllocation {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceAddress address = 0;
+    void* mapped = nullptr;
+};
+
+// Device wide ring of transient blocks. Command buffers borrow blocks while recording and hand them back when they are
+// reset or freed, so recording only allocates device memory until the ring has grown to the working set of the app.
+struct TransientBlockPool {
+    static constexpr VkDeviceSize kBlockSize = 256 * 1024;
+
+    void Init(DeviceData* device_data, uint32_t memory_type_index, VkBufferUsageFlags usage);
+    void Destroy();
+
+    VkResult Acquire(VkDeviceSize min_size, TransientBlock* block);
+    void Release(std::vector<TransientBlock>& blocks);
+
+  private:
+    VkResult CreateBlock(VkDeviceSize size, TransientBlock* block);
+    void DestroyBlock(const TransientBlock& block);
+
+    DeviceData* device_data_ = nullptr;
+    uint32_t memory_type_index_ = UINT32_MAX;
+    VkBufferUsageFlags usage_ = 0;
+    std::mutex lock_;
+    std::deque<TransientBlock> free_blocks_;
+};
+
+// Linear allocator over the blocks a command buffer borrowed from a TransientBlockPool
+struct TransientRing {
+    std::vector<TransientBlock> blocks;
+    VkDeviceSize offset = 0;  // Offset of the next free byte in blocks.back()
+};
+
+// Device wide free list of timestamp query pools. Command buffers borrow pools while recording and hand them back when
+// they are reset or freed, after their results are read. Queries are reset in the command buffer before each write.
+struct TimestampQueryPools {
+    static constexpr uint32_t kQueryCount = 64;
+
+    void Init(DeviceData* device_data);
+    void Destroy();
+
+    VkResult Acquire(VkQueryPool* pool);
+    void Release(std::vector<VkQueryPool>& pools);
+
+  private:
+    DeviceData* device_data_ = nullptr;
+    std::mutex lock_;
+    std::vector<VkQueryPool> free_pools_;
+};
+
+// Pair of timestamps a command buffer wrote around one decompression dispatch, and the regions it covers
+struct TimestampSample {
+    VkQueryPool pool = VK_NULL_HANDLE;
+    uint32_t query = 0;  // The end timestamp follows the start timestamp
+    uint32_t region_count = 0;
+    VkDeviceSize compressed_size = 0;
+    VkDeviceSize decompressed_size = 0;
+};
+
+// Linear allocator over the query pools a command buffer borrowed from TimestampQueryPools
+struct TimestampRing {
+    std::vector<VkQueryPool> pools;
+    uint32_t next_query = 0;  // First free query in pools.back()
+    std::vector<TimestampSample> samples;
+};
+
+// Compute state the app set in a command buffer. The layer's dispatches replace the pipeline and the push constants, they
+// are restored before the next command of the app that uses them.
+struct ComputeState {
+    VkPipeline app_pipeline = VK_NULL_HANDLE;
+    VkShaderEXT app_shader = VK_NULL_HANDLE;  // Compute shader object of the app, which replaces app_pipeline
+    VkPipeline bound_pipeline = VK_NULL_HANDLE;  // Last compute pipeline bound by the app or the layer
+    // Layout of the last push of the app and the id of its push constant ranges. Constants pushed through a layout with
+    // other ranges are dropped, see the compatibility rules of pipeline layouts.
+    VkPipelineLayout push_constant_layout = VK_NULL_HANDLE;
+    uint32_t push_constant_ranges = 0;
+    // The app's push constants, maxPushConstantsSize bytes allocated by the first push. Each byte keeps the stages it was
+    // last pushed to, zero for bytes that were not pushed, up to push_constant_end.
+    std::vector<uint8_t> push_constant_values;
+    std::vector<VkShaderStageFlags> push_constant_stages;
+    uint32_t push_constant_end = 0;
+    bool replaced = false;  // The layer dispatched since the app's state was last restored
+
+    // Forgets the state of the app, keeping the storage of the push constants
+    void Reset() {
+        app_pipeline = VK_NULL_HANDLE;
+        app_shader = VK_NULL_HANDLE;
+        bound_pipeline = VK_NULL_HANDLE;
+        ClearPushConstants();
+        replaced = false;
+    }
+    void ClearPushConstants() {
+        push_constant_layout = VK_NULL_HANDLE;
+        push_constant_ranges = 0;
+        std::fill(push_constant_stages.begin(), push_constant_stages.begin() + push_constant_end, 0);
+        push_constant_end = 0;
+    }
+};
+
+struct CommandBufferData {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    TransientRing upload_ring;
+    // Regions of the decompression calls recorded since the last command that needed them to be dispatched
+    std::vector<VkDecompressMemoryRegionEXT> batched_regions;
+    TimestampRing timestamps;
+    ComputeState compute_state;
+};
+
 struct DeviceFeatures {
     DeviceFeatures(uint32_t api_version, const VkDeviceCreateInfo* create_info);
     DeviceFeatures() : decompression(false) {}
     bool decompression;
 };
 
+// A pipeline compiled on a background thread, so that device creation does not wait for the driver compiler.
+// Get() blocks until the pipeline is ready and returns VK_NULL_HANDLE if it could not be built.
+struct DeferredPipeline {
+    std::thread thread;
+    std::shared_future<VkPipeline> pipeline;
+
+    VkPipeline Get() const { return pipeline.valid() ? pipeline.get() : VK_NULL_HANDLE; }
+    void Join() {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+
 struct DeviceData {
     DeviceData(VkDevice device, PFN_vkGetDeviceProcAddr gpa, const DeviceFeatures& feat, bool enable_layer,
                const VkAllocationCallbacks* alloc);
@@ -111,33 +264,83 @@ struct DeviceData {
     DeviceData& operator=(const DeviceData&) = delete;
 
     VkResult CreatePipelineState(VkDevice* pDevice, VkPhysicalDevice physicalDevice);
+    void StorePipelineCache();
     void DestroyPipelineState();
 
+    VkResult AllocateTransient(TransientRing& ring, VkDeviceSize size, VkDeviceSize alignment, TransientAllocation* allocation);
+
+    CommandBufferData* GetCommandBufferData(VkCommandBuffer command_buffer);
+    void ReleaseCommandBufferResources(CommandBufferData& cb_data);
+
+    void CollectTimestamps(TimestampRing& ring);
+    void DumpStatistics(bool force);
+
     VkDevice device;
     const VkAllocationCallbacks* allocator;
     DeviceFeatures features;
     bool enable_layer;
     uint32_t api_version;
+    // Regions hold whole GDeflate streams (header, tile offset table and tiles) rather than a single raw tile
+    bool streamFormat = false;
+    // Shader variant overrides, a zero width selects the variant from the subgroup size
+    uint32_t shaderSimdWidth = 0;
+    bool shaderInt16 = true;
+    bool shaderInt64 = true;
+    // Directory the pipeline cache of the built-in pipelines is persisted to, empty to disable
+    std::string pipelineCachePath;
+    // File of shader variants measured per device, used when no width is forced
+    std::string tuningFile;
+    // Decode Huffman codes through lookup tables in shared memory instead of comparing against the canonical base codes
+    bool huffmanLut = false;
+    // Record consecutive vkCmdDecompressMemoryNV and vkCmdDecompressMemoryEXT calls of a command buffer as a single dispatch
+    bool batchCommands = true;
+    // Time the decompression dispatches with timestamp queries and count the bytes they process
+    bool instrumentation = false;
+    // CSV file the statistics of every period are appended to, empty to disable
+    std::string instrumentationFile;
+    uint32_t instrumentationPeriod = 1000;  // Milliseconds
 
-    VkBuffer indirectDispatchBuffer;
-    VkDeviceMemory indirectDispatchBufferMemory;
-    VkDeviceAddress indirectDispatchBufferAddress;
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    uint32_t uploadMemoryTypeIndex;
+    uint32_t maxComputeWorkGroupCountX;
+    uint32_t maxPushConstantsSize;
 
     VkPipelineLayout pipelineLayoutDecompressSingle;
-    VkPipeline pipelineDecompressSingle;
+    DeferredPipeline pipelineDecompressSingle;
     VkPipelineLayout pipelineLayoutDecompressMulti;
-    VkPipeline pipelineDecompressMulti;
-    VkPipelineLayout pipelineLayoutCopy;
-    VkPipeline pipelineCopy;
+    DeferredPipeline pipelineDecompressMulti;
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+    // Cache file and the data loaded from it, the file is written once no pipeline build is pending
+    std::string pipelineCacheFile;
+    std::vector<uint8_t> initialPipelineCacheData;
+    std::atomic<uint32_t> pendingPipelines{0};
+    // Command buffers with batched regions, lets the hooks of the other commands skip the command buffer lookup
+    std::atomic<uint32_t> batchedCommandBuffers{0};
+    // Command buffers with compute state to restore, lets the dispatch hooks skip the command buffer lookup
+    std::atomic<uint32_t> replacedComputeStates{0};
+
+    float timestampPeriod = 1.0f;  // Nanoseconds per timestamp tick
+    TimestampQueryPools timestamp_pools;
+    std::mutex statisticsLock;
+    VkMemoryDecompressionStatisticsKHRONOS statistics = {};
+    // Totals of the last line written to instrumentationFile
+    VkMemoryDecompressionStatisticsKHRONOS dumpedStatistics = {};
+    std::chrono::steady_clock::time_point dumpTime;
 
-    struct PushConstantDataCopy {
-        uint64_t srcCountAddress;
-        uint64_t destCountAddress;
-    };
     struct PushConstantDataDecompressMulti {
         uint64_t paramsAddress;
         uint32_t stride;
+        uint32_t maxCount;      // Upper bound of the count read from countAddress
+        uint64_t countAddress;  // Zero when the dispatch has one workgroup per command
     };
+
+    TransientBlockPool upload_pool;
+    vku::concurrent::unordered_map<VkCommandBuffer, std::shared_ptr<CommandBufferData>> command_buffer_map;
+    // Id of the push constant ranges of each pipeline layout of the app, layouts with identical ranges share the id
+    vku::concurrent::unordered_map<VkPipelineLayout, uint32_t> pipeline_layout_map;
+    std::mutex push_constant_ranges_lock;
+    std::map<std::vector<std::tuple<uint32_t, uint32_t, VkShaderStageFlags>>, uint32_t> push_constant_ranges_ids;
+
     struct DeviceDispatchTable {
         DECLARE_HOOK(GetDeviceProcAddr);
         DECLARE_HOOK(DestroyDevice);
@@ -156,16 +359,49 @@ struct DeviceData {
         DECLARE_HOOK(DestroyPipeline);
         DECLARE_HOOK(CreatePipelineLayout);
         DECLARE_HOOK(CreateComputePipelines);
+        DECLARE_HOOK(CreatePipelineCache);
+        DECLARE_HOOK(DestroyPipelineCache);
+        DECLARE_HOOK(GetPipelineCacheData);
+        DECLARE_HOOK(AllocateCommandBuffers);
+        DECLARE_HOOK(FreeCommandBuffers);
+        DECLARE_HOOK(ResetCommandBuffer);
+        DECLARE_HOOK(ResetCommandPool);
+        DECLARE_HOOK(DestroyCommandPool);
         DECLARE_HOOK(BeginCommandBuffer);
         DECLARE_HOOK(CmdBindPipeline);
         DECLARE_HOOK(CmdPushConstants);
+        DECLARE_HOOK(CmdPushConstants2);
+        DECLARE_HOOK(CmdBindShadersEXT);
+        DECLARE_HOOK(CreateQueryPool);
+        DECLARE_HOOK(DestroyQueryPool);
+        DECLARE_HOOK(GetQueryPoolResults);
         DECLARE_HOOK(CmdDispatch);
         DECLARE_HOOK(CmdDispatchIndirect);
+        DECLARE_HOOK(CmdDispatchBase);
         DECLARE_HOOK(CmdPipelineBarrier);
+        DECLARE_HOOK(CmdPipelineBarrier2);
+        DECLARE_HOOK(CmdSetEvent);
+        DECLARE_HOOK(CmdResetEvent);
+        DECLARE_HOOK(CmdSetEvent2);
+        DECLARE_HOOK(CmdResetEvent2);
+        DECLARE_HOOK(CmdWaitEvents);
+        DECLARE_HOOK(CmdWaitEvents2);
+        DECLARE_HOOK(CmdBeginQuery);
+        DECLARE_HOOK(CmdEndQuery);
+        DECLARE_HOOK(CmdWriteTimestamp);
+        DECLARE_HOOK(CmdResetQueryPool);
+        DECLARE_HOOK(CmdWriteTimestamp2);
+        DECLARE_HOOK(CmdBeginRenderPass);
+        DECLARE_HOOK(CmdBeginRenderPass2);
+        DECLARE_HOOK(CmdBeginRendering);
+        DECLARE_HOOK(CmdExecuteCommands);
         DECLARE_HOOK(EndCommandBuffer);
         DECLARE_HOOK(QueueSubmit);
+        DECLARE_HOOK(QueueSubmit2);
         DECLARE_HOOK(CmdDecompressMemoryNV);
         DECLARE_HOOK(CmdDecompressMemoryIndirectCountNV);
+        DECLARE_HOOK(CmdDecompressMemoryEXT);
+        DECLARE_HOOK(CmdDecompressMemoryIndirectCountEXT);
     } vtable;
 };
 #undef DECLARE_HOOK
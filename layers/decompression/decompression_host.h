@@ -0,0 +1,44 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+// Layer specific entry point of VK_LAYER_KHRONOS_memory_decompression, available through vkGetDeviceProcAddr for every
+// device the layer is active on, including devices it does not implement the decompression extensions for. Applications
+// copy or include this header.
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A VkDecompressMemoryRegionEXT in host memory, such as mapped host visible device memory
+typedef struct VkDecompressMemoryRegionHostKHRONOS {
+    const void* pSrc;
+    void* pDst;
+    VkDeviceSize compressedSize;
+    VkDeviceSize decompressedSize;  // Exact size the region decompresses to
+    VkMemoryDecompressionMethodFlagsEXT decompressionMethod;
+} VkDecompressMemoryRegionHostKHRONOS;
+
+// Decompresses the regions on the calling thread and up to one worker thread per core before returning. Regions hold
+// a raw GDeflate tile each, or a whole GDeflate stream each when the gdeflate_stream_format setting is enabled, the same
+// data vkCmdDecompressMemoryNV and vkCmdDecompressMemoryEXT take. Returns VK_ERROR_FORMAT_NOT_SUPPORTED if a region
+// uses another method than GDeflate 1.0, and VK_ERROR_UNKNOWN if a region is malformed, in which case the contents of
+// every destination are undefined.
+typedef VkResult(VKAPI_PTR* PFN_vkDecompressMemoryHostKHRONOS)(VkDevice device, uint32_t regionCount,
+                                                               const VkDecompressMemoryRegionHostKHRONOS* pRegions);
+
+#ifdef __cplusplus
+}
+#endif
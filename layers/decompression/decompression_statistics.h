@@ -0,0 +1,41 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+// Layer specific entry point of VK_LAYER_KHRONOS_memory_decompression, available through vkGetDeviceProcAddr when the
+// layer implements the decompression extensions for the device. Applications copy or include this header.
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Totals since the device was created, over the decompressions the layer dispatched and the GPU finished. Results are
+// collected when the command buffer that recorded them is reset, begun again or freed. Subtracting two samples gives
+// the cost of the frames in between.
+typedef struct VkMemoryDecompressionStatisticsKHRONOS {
+    uint64_t dispatchCount;      // Decompression dispatches, a batch of calls counts once
+    uint64_t regionCount;        // Regions of vkCmdDecompressMemoryNV and vkCmdDecompressMemoryEXT calls
+    uint64_t compressedBytes;    // Compressed size of those regions, indirect commands are not read back
+    uint64_t decompressedBytes;  // Decompressed size of those regions
+    uint64_t gpuNanoseconds;     // Time between the timestamps written around each dispatch
+} VkMemoryDecompressionStatisticsKHRONOS;
+
+// Returns VK_ERROR_FEATURE_NOT_PRESENT unless the layer's instrumentation setting is enabled
+typedef VkResult(VKAPI_PTR* PFN_vkGetMemoryDecompressionStatisticsKHRONOS)(VkDevice device,
+                                                                            VkMemoryDecompressionStatisticsKHRONOS* pStatistics);
+
+#ifdef __cplusplus
+}
+#endif
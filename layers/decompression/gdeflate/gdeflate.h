@@ -0,0 +1,110 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Host implementation of the GDeflate format decoded by the memory decompression layer's shaders.
+//
+// A GDeflate tile is a deflate stream whose bits are spread over 32 interleaved bit streams, one per lane of the GPU
+// decoder. The host decoder replays the lane schedule of shaders/GInflate.glsl exactly, so it produces the same bytes as
+// the GPU for any tile the shaders accept.
+namespace gdeflate {
+
+// Number of interleaved bit streams in a tile
+constexpr uint32_t kNumStreams = 32;
+
+// Size of the data a tile of a GDeflate stream decompresses to, only the last tile of a stream may be smaller
+constexpr uint32_t kTileSize = 64 * 1024;
+
+// Identifier and its complement found in the first two bytes of a GDeflate stream
+constexpr uint8_t kStreamId = 4;
+constexpr uint8_t kStreamMagic = 0xFB;
+
+// Size of the stream header preceding the tile offset table
+constexpr size_t kStreamHeaderSize = 8;
+
+struct StreamInfo {
+    uint32_t num_tiles;
+    uint32_t last_tile_size;  // Decompressed size of the last tile, kTileSize if the header stores zero
+    size_t decompressed_size;
+    size_t data_offset;  // Offset of the first tile from the start of the stream
+};
+
+// Decompresses a single raw tile into dst. Returns false if the tile is malformed or does not fit in dst_size bytes.
+bool DecompressTile(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, size_t* decompressed_size);
+
+// Parses the header of a GDeflate stream: an 8 byte header holding the tile count, followed by a table of tile offsets
+// relative to the end of the table. The first table entry holds the compressed size of the last tile instead.
+bool GetStreamInfo(const uint8_t* src, size_t src_size, StreamInfo* info);
+
+// Decompresses a whole GDeflate stream, decoding its tiles on up to num_threads threads. Zero uses one thread per core.
+bool DecompressStream(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, uint32_t num_threads = 0);
+
+// Compressed data in host memory and the memory it decompresses to, like a VkDecompressMemoryRegionNV with pointers
+struct HostRegion {
+    const uint8_t* src;
+    size_t src_size;
+    uint8_t* dst;
+    size_t dst_size;  // Exact size of the decompressed data
+};
+
+// Decompresses regions holding a single raw tile each, or a whole GDeflate stream each if streams is set. The tiles of
+// all regions are handed out to up to num_threads threads as they finish their previous tile, zero using one thread per
+// core, so a few large streams keep as many threads busy as many small ones. Returns false if a region is malformed or
+// does not decompress to exactly dst_size bytes.
+bool DecompressRegions(const HostRegion* regions, size_t count, bool streams, uint32_t num_threads = 0);
+
+// Compression levels, 0 stores tiles uncompressed and 9 searches longest for matches
+constexpr uint32_t kMinLevel = 0;
+constexpr uint32_t kMaxLevel = 9;
+constexpr uint32_t kDefaultLevel = 6;
+
+// Location of a compressed tile in a stream and of its data once decompressed. Offsets are relative to the start of the
+// stream and of the decompressed data, adding the buffer addresses gives a VkDecompressMemoryRegionNV.
+struct TileRegion {
+    size_t src_offset;
+    size_t compressed_size;
+    size_t dst_offset;
+    size_t decompressed_size;
+};
+
+// Compresses up to kTileSize bytes into a raw tile appended to dst. The tile size is a multiple of 4 bytes.
+bool CompressTile(const uint8_t* src, size_t src_size, uint32_t level, std::vector<uint8_t>* dst);
+
+// Compresses src into a GDeflate stream in dst, compressing its tiles on up to num_threads threads. Zero uses one
+// thread per core. regions receives the location of every tile if not null.
+bool CompressStream(const uint8_t* src, size_t src_size, uint32_t level, std::vector<uint8_t>* dst,
+                    std::vector<TileRegion>* regions = nullptr, uint32_t num_threads = 0);
+
+// Entry of the tables written by "gdeflate embed", locating the GDeflate stream one input file was compressed into.
+// Inputs with the same contents share a stream.
+struct EmbeddedStream {
+    uint32_t offset;  // Offset of the stream in the generated byte array
+    uint32_t size;
+    uint32_t decompressed_size;
+};
+
+// Synthetic data for testing and benchmarking the codec
+enum class Corpus { kText, kTexture, kMesh, kRandom, kIncompressible };
+
+// Parses the names returned by CorpusName
+bool ParseCorpus(const char* name, Corpus* corpus);
+const char* CorpusName(Corpus corpus);
+
+// Replaces the contents of dst with size bytes of the given kind of data. The same seed always gives the same data.
+void GenerateCorpus(Corpus corpus, size_t size, uint32_t seed, std::vector<uint8_t>* dst);
+
+}  // namespace gdeflate
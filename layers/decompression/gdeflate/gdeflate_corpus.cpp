@@ -0,0 +1,211 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#include "gdeflate.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace gdeflate {
+namespace {
+
+const char* const kCorpusNames[] = {"text", "texture", "mesh", "random", "incompressible"};
+
+// Same sequence on every platform, unlike the distributions of <random>
+class Random {
+  public:
+    explicit Random(uint32_t seed) : state_(seed * 0x9E3779B97F4A7C15ull + 1) {}
+
+    uint32_t Next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return static_cast<uint32_t>((state_ * 0x2545F4914F6CDD1Dull) >> 32);
+    }
+
+    uint32_t Below(uint32_t n) { return static_cast<uint32_t>((static_cast<uint64_t>(Next()) * n) >> 32); }
+
+  private:
+    uint64_t state_;
+};
+
+// Smooth 2D noise in [0, 255] from random values on a grid with the given cell size, bilinearly interpolated
+class ValueNoise {
+  public:
+    ValueNoise(Random& random, uint32_t width, uint32_t height, uint32_t cell)
+        : cell_(cell), columns_(width / cell + 2), values_(static_cast<size_t>(columns_) * (height / cell + 2)) {
+        for (uint8_t& value : values_) {
+            value = static_cast<uint8_t>(random.Next());
+        }
+    }
+
+    uint32_t At(uint32_t x, uint32_t y) const {
+        const uint32_t cx = x / cell_, cy = y / cell_;
+        const uint32_t fx = x % cell_, fy = y % cell_;
+        const uint32_t v00 = Value(cx, cy), v10 = Value(cx + 1, cy);
+        const uint32_t v01 = Value(cx, cy + 1), v11 = Value(cx + 1, cy + 1);
+        const uint32_t top = v00 * (cell_ - fx) + v10 * fx;
+        const uint32_t bottom = v01 * (cell_ - fx) + v11 * fx;
+        return (top * (cell_ - fy) + bottom * fy) / (cell_ * cell_);
+    }
+
+  private:
+    uint32_t Value(uint32_t x, uint32_t y) const { return values_[static_cast<size_t>(y) * columns_ + x]; }
+
+    uint32_t cell_;
+    uint32_t columns_;
+    std::vector<uint8_t> values_;
+};
+
+// Sentences of words drawn from a small vocabulary with a skewed distribution
+void GenerateText(Random& random, size_t size, std::vector<uint8_t>* dst) {
+    static const char* const kSyllables[] = {"ka", "ren", "to", "mi", "sha", "lo", "ver", "din", "a",  "pe",
+                                             "qua", "tor", "in", "el", "us", "ne", "ro", "fi", "gan", "th"};
+    std::vector<std::string> words(512);
+    for (std::string& word : words) {
+        for (uint32_t i = 1 + random.Below(3); i > 0; --i) {
+            word += kSyllables[random.Below(20)];
+        }
+    }
+
+    while (dst->size() < size) {
+        const uint32_t length = 4 + random.Below(16);
+        for (uint32_t i = 0; i < length; ++i) {
+            // Cubing a uniform value favours the first words
+            const uint32_t u = random.Below(1024);
+            std::string word = words[(static_cast<uint64_t>(u) * u * u * words.size()) >> 30];
+            if (i == 0) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+            dst->insert(dst->end(), word.begin(), word.end());
+            dst->push_back(i + 1 == length ? '.' : (random.Below(8) == 0 ? ',' : ' '));
+            if (i + 1 < length && dst->back() == ',') dst->push_back(' ');
+        }
+        dst->push_back(random.Below(4) == 0 ? '\n' : ' ');
+    }
+}
+
+// RGBA8 images made of two octaves of noise plus per pixel jitter
+void GenerateTexture(Random& random, size_t size, std::vector<uint8_t>* dst) {
+    const uint32_t kWidth = 1024, kHeight = 1024;
+    while (dst->size() < size) {
+        const ValueNoise coarse(random, kWidth, kHeight, 128);
+        const ValueNoise fine(random, kWidth, kHeight, 16);
+        const uint32_t tint[3] = {random.Below(256), random.Below(256), random.Below(256)};
+        for (uint32_t y = 0; y < kHeight && dst->size() < size; ++y) {
+            for (uint32_t x = 0; x < kWidth; ++x) {
+                const uint32_t value = (3 * coarse.At(x, y) + fine.At(x, y)) / 4;
+                for (uint32_t c = 0; c < 3; ++c) {
+                    const uint32_t jitter = random.Below(4);
+                    dst->push_back(static_cast<uint8_t>(std::min((value * tint[c]) / 255 + jitter, 255u)));
+                }
+                dst->push_back(255);
+            }
+        }
+    }
+}
+
+// Height field meshes, interleaved position/normal/uv vertices followed by 32-bit triangle indices
+void GenerateMesh(Random& random, size_t size, std::vector<uint8_t>* dst) {
+    const uint32_t kGrid = 64;
+    while (dst->size() < size) {
+        const ValueNoise height(random, kGrid, kGrid, 8);
+        const float scale = 0.1f + static_cast<float>(random.Below(100)) / 100.0f;
+        for (uint32_t z = 0; z < kGrid; ++z) {
+            for (uint32_t x = 0; x < kGrid; ++x) {
+                const float h = static_cast<float>(height.At(x, z)) * scale / 255.0f;
+                const float dx = static_cast<float>(static_cast<int>(height.At(std::min(x + 1, kGrid - 1), z)) -
+                                                    static_cast<int>(height.At(x > 0 ? x - 1 : 0, z))) /
+                                 255.0f;
+                const float dz = static_cast<float>(static_cast<int>(height.At(x, std::min(z + 1, kGrid - 1))) -
+                                                    static_cast<int>(height.At(x, z > 0 ? z - 1 : 0))) /
+                                 255.0f;
+                const float vertex[8] = {static_cast<float>(x), h, static_cast<float>(z), -dx, 1.0f, -dz,
+                                         static_cast<float>(x) / (kGrid - 1), static_cast<float>(z) / (kGrid - 1)};
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(vertex);
+                dst->insert(dst->end(), bytes, bytes + sizeof(vertex));
+            }
+        }
+        for (uint32_t z = 0; z + 1 < kGrid; ++z) {
+            for (uint32_t x = 0; x + 1 < kGrid; ++x) {
+                const uint32_t i = z * kGrid + x;
+                const uint32_t indices[6] = {i, i + kGrid, i + 1, i + 1, i + kGrid, i + kGrid + 1};
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(indices);
+                dst->insert(dst->end(), bytes, bytes + sizeof(indices));
+            }
+        }
+    }
+}
+
+// Bytes from a skewed distribution, mixed with repeats of earlier data at random distances
+void GenerateRandom(Random& random, size_t size, std::vector<uint8_t>* dst) {
+    while (dst->size() < size) {
+        if (dst->size() > 64 && random.Below(4) == 0) {
+            const size_t length = 4 + random.Below(60);
+            const size_t from = dst->size() - 1 - random.Below(static_cast<uint32_t>(std::min<size_t>(dst->size() - 1, 32768)));
+            for (size_t i = 0; i < length; ++i) {
+                dst->push_back((*dst)[from + i]);
+            }
+        } else {
+            const uint32_t u = random.Below(256);
+            dst->push_back(static_cast<uint8_t>((u * u) >> 8));
+        }
+    }
+}
+
+void GenerateIncompressible(Random& random, size_t size, std::vector<uint8_t>* dst) {
+    while (dst->size() < size) {
+        const uint32_t value = random.Next();
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        dst->insert(dst->end(), bytes, bytes + sizeof(value));
+    }
+}
+
+}  // namespace
+
+bool ParseCorpus(const char* name, Corpus* corpus) {
+    for (uint32_t i = 0; i < sizeof(kCorpusNames) / sizeof(kCorpusNames[0]); ++i) {
+        if (strcmp(name, kCorpusNames[i]) == 0) {
+            *corpus = static_cast<Corpus>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* CorpusName(Corpus corpus) { return kCorpusNames[static_cast<uint32_t>(corpus)]; }
+
+void GenerateCorpus(Corpus corpus, size_t size, uint32_t seed, std::vector<uint8_t>* dst) {
+    Random random(seed);
+    dst->clear();
+    dst->reserve(size + 64 * 1024);
+    switch (corpus) {
+        case Corpus::kText:
+            GenerateText(random, size, dst);
+            break;
+        case Corpus::kTexture:
+            GenerateTexture(random, size, dst);
+            break;
+        case Corpus::kMesh:
+            GenerateMesh(random, size, dst);
+            break;
+        case Corpus::kRandom:
+            GenerateRandom(random, size, dst);
+            break;
+        case Corpus::kIncompressible:
+            GenerateIncompressible(random, size, dst);
+            break;
+    }
+    dst->resize(size);
+}
+
+}  // namespace gdeflate
@@ -0,0 +1,632 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#include "gdeflate.h"
+#include "gdeflate_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace gdeflate {
+namespace {
+
+// Symbol table layout shared by both decoders, distance codes follow the 288 literal/length codes
+constexpr uint32_t kMaxSymbols = 288 + 32;
+constexpr uint32_t kDistanceCodesBase = 288;
+
+// Codes up to this length are decoded with a single table lookup
+constexpr uint32_t kLutBits = 10;
+constexpr uint32_t kLutSize = 1u << kLutBits;
+
+// Longest literal/length or distance code including its extra bits
+constexpr uint32_t kMaxCodeBits = 15 + 16;
+
+// Words read past the end of the tile by lanes prefetching their next bits. Every lane buffers less than two words, so
+// a valid tile never reads further than this.
+constexpr uint32_t kPaddingWords = 3 * kNumLanes;
+
+// Base value and number of extra bits of distance codes, followed by literal/length codes (Deflate64 variant)
+const uint32_t kTranslateLut[64] = {
+    // Distance
+    (1 << 16) | 0, (2 << 16) | 0, (3 << 16) | 0, (4 << 16) | 0, (5 << 16) | 1, (7 << 16) | 1, (9 << 16) | 2, (13 << 16) | 2,
+    (17 << 16) | 3, (25 << 16) | 3, (33 << 16) | 4, (49 << 16) | 4, (65 << 16) | 5, (97 << 16) | 5, (129 << 16) | 6,
+    (193 << 16) | 6, (257 << 16) | 7, (385 << 16) | 7, (513 << 16) | 8, (769 << 16) | 8, (1025 << 16) | 9, (1537 << 16) | 9,
+    (2049 << 16) | 10, (3073 << 16) | 10, (4097 << 16) | 11, (6145 << 16) | 11, (8193 << 16) | 12, (12289 << 16) | 12,
+    (16385 << 16) | 13, (24577 << 16) | 13, (32769u << 16) | 14, (49153u << 16) | 14,
+    // Literal/length
+    (1 << 16) | 0, (0 << 16) | 0, (3 << 16) | 0, (4 << 16) | 0, (5 << 16) | 0, (6 << 16) | 0, (7 << 16) | 0, (8 << 16) | 0,
+    (9 << 16) | 0, (10 << 16) | 0, (11 << 16) | 1, (13 << 16) | 1, (15 << 16) | 1, (17 << 16) | 1, (19 << 16) | 2,
+    (23 << 16) | 2, (27 << 16) | 2, (31 << 16) | 2, (35 << 16) | 3, (43 << 16) | 3, (51 << 16) | 3, (59 << 16) | 3,
+    (67 << 16) | 4, (83 << 16) | 4, (99 << 16) | 4, (115 << 16) | 4, (131 << 16) | 5, (163 << 16) | 5, (195 << 16) | 5,
+    (227 << 16) | 5, (3 << 16) | 16, 0};
+
+// Decodes one tile by running the 32 lanes of shaders/GInflate.glsl in lock step. Each step of the shader is applied to
+// all lanes before the next one starts, as the order in which lanes refill their bit buffers defines where each lane's
+// bits are in the tile.
+class TileDecoder {
+  public:
+    TileDecoder(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size);
+
+    bool Decompress(size_t* decompressed_size);
+
+  private:
+    void InitBitReader();
+    void PeekAll();
+    void Eat(const uint32_t* n, uint32_t lanes);
+    void Eat(uint32_t n, uint32_t lanes);
+    void Refill(uint32_t lanes);
+
+    void InitDecoders(const uint32_t* counts, uint32_t max_len);
+    void InitSymbolTable(uint32_t hlit);
+    void InitLookupTables();
+    uint32_t LengthForCode(uint32_t code, uint32_t base) const;
+    uint32_t DecodeSlow(uint32_t bits, bool is_dist, uint32_t* len) const;
+    void DecodeAll(uint32_t dist_lanes, uint32_t* sym, uint32_t* len) const;
+
+    bool UnpackCodeLengths(uint32_t hlit, uint32_t hdist, uint32_t hclen, uint32_t* counts);
+    void FixedCodeLengths(uint32_t* counts);
+    bool CompressedBlock(uint32_t hlit, const uint32_t* counts, uint32_t* dst);
+    bool UncompressedBlock(uint32_t size, uint32_t* dst);
+    bool CoalesceOutput(uint32_t dst, const uint32_t* offset, const uint32_t* dist, const uint32_t* length,
+                        const uint32_t* byte, uint32_t copy_lanes);
+
+    std::vector<uint32_t> words_;
+    uint32_t num_words_;
+    uint8_t* dst_;
+    size_t dst_size_;
+    bool error_ = false;
+    const bool avx2_;
+
+    // Cooperative bit reader, each lane holds up to 64 bits of its stream
+    alignas(32) uint64_t buf_[kNumLanes];
+    alignas(32) uint32_t cnt_[kNumLanes];
+    alignas(32) uint32_t bits_[kNumLanes];
+    uint32_t base_ = 0;
+
+    // Canonical decoders for literal/length codes in the lower 16 entries and distance codes in the upper 16 entries
+    uint32_t base_codes_[kNumLanes];
+    uint32_t offsets_[kNumLanes];
+    uint16_t symbols_[kMaxSymbols];
+    // Symbol and length of short codes indexed by the next kLutBits bits, zero for longer codes
+    alignas(32) uint32_t lut_[2 * kLutSize];
+
+    // Code lengths of the current block, distance codes follow the hlit literal/length codes
+    uint8_t code_lengths_[512];
+};
+
+TileDecoder::TileDecoder(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size)
+    : num_words_(static_cast<uint32_t>((src_size + 3) / 4)), dst_(dst), dst_size_(dst_size), avx2_(internal::HasAvx2()) {
+    words_.assign(num_words_ + kPaddingWords, 0);
+    memcpy(words_.data(), src, src_size);
+    memset(symbols_, 0, sizeof(symbols_));
+}
+
+void TileDecoder::InitBitReader() {
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        buf_[lane] = words_[lane];
+        cnt_[lane] = 32;
+    }
+    base_ = kNumLanes;
+}
+
+void TileDecoder::PeekAll() {
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        bits_[lane] = static_cast<uint32_t>(buf_[lane]);
+    }
+}
+
+// Lanes below 32 bits get the next words of the tile in lane order
+void TileDecoder::Refill(uint32_t lanes) {
+    if (base_ + kNumLanes > words_.size()) {
+        // Only malformed tiles read this far past their end
+        error_ = true;
+        return;
+    }
+    uint32_t rank = 0;
+    while (lanes != 0) {
+        const uint32_t lane = internal::CountTrailingZeros(lanes);
+        buf_[lane] |= static_cast<uint64_t>(words_[base_ + rank]) << cnt_[lane];
+        cnt_[lane] += 32;
+        ++rank;
+        lanes &= lanes - 1;
+    }
+    base_ += rank;
+}
+
+void TileDecoder::Eat(const uint32_t* n, uint32_t lanes) {
+    uint32_t refill = 0;
+    if (avx2_) {
+        refill = internal::EatAvx2(buf_, cnt_, n, lanes);
+    } else {
+#if defined(GDEFLATE_NEON)
+        refill = internal::EatNeon(buf_, cnt_, n, lanes);
+#else
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (lanes & (1u << lane)) {
+                buf_[lane] >>= n[lane];
+                cnt_[lane] -= n[lane];
+                if (cnt_[lane] < 32) refill |= 1u << lane;
+            }
+        }
+#endif
+    }
+    Refill(refill);
+}
+
+void TileDecoder::Eat(uint32_t n, uint32_t lanes) {
+    uint32_t amounts[kNumLanes];
+    std::fill(amounts, amounts + kNumLanes, n);
+    Eat(amounts, lanes);
+}
+
+// Builds two decoders at once from histograms of code lengths (GInflate.glsl DecoderPair_init)
+void TileDecoder::InitDecoders(const uint32_t* counts, uint32_t max_len) {
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        const uint32_t half = lane & 16;
+        const uint32_t len = lane & 15;
+
+        // Offsets into the symbol table of the codes one bit longer than this lane's length
+        uint32_t offset = 0;
+        for (uint32_t i = half; i <= lane; ++i) {
+            offset += counts[i];
+        }
+        offsets_[lane] = offset;
+
+        // Left-aligned first code of length len + 1, saturated when the code space overflows
+        uint32_t base_code = 0;
+        for (uint32_t i = 1; i < max_len; ++i) {
+            if (len >= i) base_code += counts[half + i] << (len - i);
+        }
+        const uint32_t aligned = len == 0 ? 0 : base_code << (32 - len);
+        base_codes_[lane] = (aligned < base_code || len >= max_len) ? 0xffffffff : aligned;
+    }
+}
+
+// Scatters symbols by code length in canonical order (GInflate.glsl SymbolTable_init)
+void TileDecoder::InitSymbolTable(uint32_t hlit) {
+    uint32_t next[kNumLanes] = {};
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        if (lane != 15 && lane != 31) next[lane + 1] = offsets_[lane];
+    }
+    for (uint32_t sym = 0; sym < hlit; ++sym) {
+        const uint32_t len = code_lengths_[sym];
+        if (len != 0 && next[len] < kDistanceCodesBase) symbols_[next[len]++] = static_cast<uint16_t>(sym);
+    }
+    for (uint32_t sym = 0; sym < kNumLanes; ++sym) {
+        const uint32_t len = code_lengths_[hlit + sym];
+        if (len != 0 && kDistanceCodesBase + next[16 + len] < kMaxSymbols) {
+            symbols_[kDistanceCodesBase + next[16 + len]++] = static_cast<uint16_t>(sym);
+        }
+    }
+}
+
+uint32_t TileDecoder::LengthForCode(uint32_t code, uint32_t base) const {
+    uint32_t len = 1;
+    if (code >= base_codes_[7 + base]) len = 8;
+    if (code >= base_codes_[len + 3 + base]) len += 4;
+    if (code >= base_codes_[len + 1 + base]) len += 2;
+    if (code >= base_codes_[len + base]) len += 1;
+    return len;
+}
+
+uint32_t TileDecoder::DecodeSlow(uint32_t bits, bool is_dist, uint32_t* len) const {
+    const uint32_t code = internal::BitReverse(bits);
+    const uint32_t base = is_dist ? 16 : 0;
+    *len = LengthForCode(code, base);
+    const uint32_t i = *len + base - 1;
+    const uint32_t id = offsets_[i] + ((code - base_codes_[i]) >> (32 - *len)) + (is_dist ? kDistanceCodesBase : 0);
+    // Codes outside of the code space only show up in lanes whose symbols are discarded
+    return id < kMaxSymbols ? symbols_[id] : 0;
+}
+
+// Tabulates the decoder for all codes of up to kLutBits bits. The bits past a short code only affect the result of
+// DecodeSlow if the base codes are not ascending, which is left to the slow path.
+void TileDecoder::InitLookupTables() {
+    for (uint32_t table = 0; table < 2; ++table) {
+        const uint32_t* base_codes = base_codes_ + table * 16;
+        bool well_formed = true;
+        for (uint32_t len = 1; len < 15; ++len) {
+            well_formed &= base_codes[len] >= base_codes[len - 1];
+            well_formed &= len > kLutBits || base_codes[len] != 0xffffffff;
+        }
+        for (uint32_t bits = 0; bits < kLutSize; ++bits) {
+            uint32_t len = 0;
+            const uint32_t sym = DecodeSlow(bits, table != 0, &len);
+            lut_[table * kLutSize + bits] = well_formed && len <= kLutBits ? (sym | (len << 16)) : 0;
+        }
+    }
+}
+
+void TileDecoder::DecodeAll(uint32_t dist_lanes, uint32_t* sym, uint32_t* len) const {
+    alignas(32) uint32_t entries[kNumLanes];
+    if (avx2_) {
+        internal::GatherAvx2(lut_, kLutBits, bits_, dist_lanes, entries);
+    } else {
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            const uint32_t table = (dist_lanes >> lane) & 1;
+            entries[lane] = lut_[table * kLutSize + (bits_[lane] & (kLutSize - 1))];
+        }
+    }
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        if (entries[lane] != 0) {
+            sym[lane] = entries[lane] & 0xffff;
+            len[lane] = entries[lane] >> 16;
+        } else {
+            sym[lane] = DecodeSlow(bits_[lane] & internal::Mask(kMaxCodeBits), (dist_lanes >> lane) & 1, &len[lane]);
+        }
+    }
+}
+
+// Reads code length codes and expands them into code_lengths_ (GInflate.glsl UnpackCodeLengths)
+bool TileDecoder::UnpackCodeLengths(uint32_t hlit, uint32_t hdist, uint32_t hclen, uint32_t* counts) {
+    static const uint32_t kLaneForId[19] = {3, 17, 15, 13, 11, 9, 7, 5, 4, 6, 8, 10, 12, 14, 16, 18, 0, 1, 2};
+
+    // Code length code lengths are stored in the first hclen lanes in the deflate order
+    PeekAll();
+    uint32_t len[kNumLanes] = {};
+    for (uint32_t lane = 0; lane < 19; ++lane) {
+        const uint32_t src_lane = kLaneForId[lane];
+        len[lane] = src_lane < hclen ? bits_[src_lane] & 7 : 0;
+    }
+    Eat(3, internal::LaneMask(hclen));
+
+    uint32_t hist[kNumLanes] = {};
+    for (uint32_t lane = 0; lane < 19; ++lane) {
+        if (len[lane] != 0) {
+            hist[len[lane]]++;
+            hist[16 + len[lane]]++;
+        }
+    }
+    InitDecoders(hist, 7);
+    uint32_t next[16];
+    for (uint32_t i = 1; i < 16; ++i) {
+        next[i] = offsets_[i - 1];
+    }
+    for (uint32_t lane = 0; lane < 19; ++lane) {
+        if (len[lane] != 0 && next[len[lane]] < kMaxSymbols) symbols_[next[len[lane]]++] = static_cast<uint16_t>(lane);
+    }
+
+    static const uint32_t kRepeatBase[4] = {1, 3, 3, 11};
+    static const uint32_t kRepeatBits[4] = {0, 2, 3, 7};
+
+    const uint32_t count = hlit + hdist;
+    uint32_t base_offset = 0;
+    uint32_t last_len = ~0u;
+    memset(code_lengths_, 0, sizeof(code_lengths_));
+    uint32_t tmp[kNumLanes] = {};
+
+    do {
+        PeekAll();
+        uint32_t sym[kNumLanes], code_len[kNumLanes], n[kNumLanes], idx[kNumLanes];
+        uint32_t not_repeat = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            const uint32_t bits = bits_[lane] & internal::Mask(14);
+            sym[lane] = DecodeSlow(bits, false, &code_len[lane]);
+            idx[lane] = sym[lane] <= 15 ? 0 : std::min(sym[lane] - 15, 3u);
+            n[lane] = kRepeatBase[idx[lane]] + ((bits >> code_len[lane]) & internal::Mask(kRepeatBits[idx[lane]]));
+            if (sym[lane] != 16) not_repeat |= 1u << lane;
+        }
+
+        // Symbol 16 repeats the length of the closest lower lane holding another symbol, or the last one of the
+        // previous round
+        uint32_t value[kNumLanes];
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            value[lane] = sym[lane] > 16 ? 0 : sym[lane];
+        }
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (sym[lane] == 16) {
+                const uint32_t prev = internal::FindMsb(not_repeat & internal::LaneMask(lane));
+                value[lane] = prev == ~0u ? last_len : (sym[prev] > 16 ? 0 : sym[prev]);
+            }
+        }
+        last_len = value[kNumLanes - 1];
+
+        uint32_t eat[kNumLanes];
+        uint32_t eat_lanes = 0;
+        uint32_t offset = base_offset;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (offset < count) {
+                if (value[lane] != 0) {
+                    const int lit = std::max(std::min(static_cast<int>(hlit) - static_cast<int>(offset), static_cast<int>(n[lane])), 0);
+                    const int dist =
+                        std::max(std::min(static_cast<int>(offset + n[lane]) - static_cast<int>(hlit), static_cast<int>(n[lane])), 0);
+                    tmp[value[lane] & 15] += static_cast<uint32_t>(lit);
+                    tmp[16 + (value[lane] & 15)] += static_cast<uint32_t>(dist);
+                    for (uint32_t i = 0; i < n[lane] && offset + i < sizeof(code_lengths_); ++i) {
+                        code_lengths_[offset + i] = static_cast<uint8_t>(value[lane] & 15);
+                    }
+                }
+                eat_lanes |= 1u << lane;
+            }
+            eat[lane] = code_len[lane] + kRepeatBits[idx[lane]];
+            offset += n[lane];
+        }
+        Eat(eat, eat_lanes);
+        base_offset = offset;
+        if (error_) return false;
+    } while (base_offset < count);
+
+    memcpy(counts, tmp, sizeof(tmp));
+    return true;
+}
+
+void TileDecoder::FixedCodeLengths(uint32_t* counts) {
+    std::fill(code_lengths_, code_lengths_ + 144, uint8_t(8));
+    std::fill(code_lengths_ + 144, code_lengths_ + 256, uint8_t(9));
+    std::fill(code_lengths_ + 256, code_lengths_ + 280, uint8_t(7));
+    std::fill(code_lengths_ + 280, code_lengths_ + 288, uint8_t(8));
+    std::fill(code_lengths_ + 288, code_lengths_ + sizeof(code_lengths_), uint8_t(5));
+
+    std::fill(counts, counts + kNumLanes, 0u);
+    counts[7] = 24;
+    counts[8] = 152;
+    counts[9] = 112;
+    counts[16 + 5] = 32;
+}
+
+// Writes literals and copies of a round. Literals go first, copies follow in lane order (GInflate.glsl CoalesceOutput)
+bool TileDecoder::CoalesceOutput(uint32_t dst, const uint32_t* offset, const uint32_t* dist, const uint32_t* length,
+                                 const uint32_t* byte, uint32_t copy_lanes) {
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        if (!(copy_lanes & (1u << lane)) && length[lane] != 0) {
+            const uint32_t pos = dst + offset[lane];
+            if (pos >= dst_size_) return false;
+            dst_[pos] = static_cast<uint8_t>(byte[lane]);
+        }
+    }
+    while (copy_lanes != 0) {
+        const uint32_t lane = internal::CountTrailingZeros(copy_lanes);
+        copy_lanes &= copy_lanes - 1;
+
+        const uint32_t pos = dst + offset[lane];
+        const uint32_t len = length[lane];
+        const uint32_t distance = dist[lane];
+        if (distance == 0 || distance > pos || static_cast<size_t>(pos) + len > dst_size_) return false;
+        uint8_t* out = dst_ + pos;
+        const uint8_t* from = out - distance;
+        if (distance >= len) {
+            memcpy(out, from, len);
+        } else {
+            // Overlapping copies repeat the last distance bytes
+            for (uint32_t i = 0; i < len; ++i) {
+                out[i] = from[i];
+            }
+        }
+    }
+    return true;
+}
+
+// Decodes a Huffman coded block, each lane handles every 32nd symbol (GInflate.glsl CompressedBlock)
+bool TileDecoder::CompressedBlock(uint32_t hlit, const uint32_t* counts, uint32_t* dst_pos) {
+    InitDecoders(counts, 15);
+    InitSymbolTable(hlit);
+    InitLookupTables();
+
+    uint32_t dst = *dst_pos;
+    uint32_t sym[kNumLanes], len[kNumLanes], value[kNumLanes], amount[kNumLanes];
+    uint32_t length[kNumLanes], offset[kNumLanes], byte[kNumLanes];
+
+    // Translates the symbols of the current round to literal lengths, copy lengths or distances and eats their bits
+    auto translate = [&](uint32_t dist_lanes, uint32_t eat_lanes) {
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            const bool is_dist = (dist_lanes >> lane) & 1;
+            const uint32_t index = is_dist ? sym[lane] : std::max(sym[lane] + 32, 255u + 32) - 255;
+            const uint32_t lookup = index < 64 ? kTranslateLut[index] : 0;
+            const uint32_t n = lookup & 0xffff;
+            amount[lane] = len[lane] + n;
+            value[lane] = (lookup >> 16) + ((bits_[lane] >> len[lane]) & internal::Mask(n));
+        }
+        Eat(amount, eat_lanes);
+    };
+    auto out_of_block = [](uint32_t eob) { return eob == 0 ? 0u : ~internal::LaneMask(internal::CountTrailingZeros(eob) + 1); };
+    auto scan = [&](uint32_t zero_lanes) {
+        uint32_t sum = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            length[lane] = (zero_lanes >> lane) & 1 ? 0 : value[lane];
+            offset[lane] = sum;
+            sum += length[lane];
+        }
+    };
+    auto end_of_block = [&]() {
+        uint32_t eob = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (sym[lane] == 256) eob |= 1u << lane;
+        }
+        return eob;
+    };
+
+    // Initial round, no copies to process yet
+    PeekAll();
+    DecodeAll(0, sym, len);
+    uint32_t eob = end_of_block();
+    uint32_t oob = out_of_block(eob);
+    translate(0, ~oob);
+    scan(oob);
+    uint32_t copy_lanes = 0;
+    for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+        if (sym[lane] > 256) copy_lanes |= 1u << lane;
+        byte[lane] = sym[lane];
+    }
+
+    while (eob == 0) {
+        if (error_) return false;
+
+        // Lanes which decoded a length in the previous round decode its distance in this one
+        PeekAll();
+        DecodeAll(copy_lanes, sym, len);
+        eob = end_of_block();
+        oob = out_of_block(eob);
+        translate(copy_lanes, copy_lanes | ~oob);
+        if (!CoalesceOutput(dst, offset, value, length, byte, copy_lanes)) return false;
+        dst += offset[kNumLanes - 1] + length[kNumLanes - 1];
+
+        scan(copy_lanes | oob);
+        copy_lanes = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (sym[lane] > 256) copy_lanes |= 1u << lane;
+            byte[lane] = sym[lane];
+        }
+    }
+
+    // One last round of copy processing
+    PeekAll();
+    DecodeAll(kAllLanes, sym, len);
+    copy_lanes &= ~oob;
+    translate(copy_lanes, copy_lanes);
+    if (!CoalesceOutput(dst, offset, value, length, byte, copy_lanes)) return false;
+    *dst_pos = dst + offset[kNumLanes - 1] + length[kNumLanes - 1];
+    return !error_;
+}
+
+// Stored block, each lane supplies every 32nd byte
+bool TileDecoder::UncompressedBlock(uint32_t size, uint32_t* dst) {
+    if (*dst + static_cast<size_t>(size) > dst_size_) return false;
+    for (uint32_t done = 0; done < size; done += kNumLanes) {
+        const uint32_t n = std::min(size - done, kNumLanes);
+        PeekAll();
+        for (uint32_t lane = 0; lane < n; ++lane) {
+            dst_[*dst + done + lane] = static_cast<uint8_t>(bits_[lane]);
+        }
+        Eat(8, internal::LaneMask(n));
+        if (error_) return false;
+    }
+    *dst += size;
+    return true;
+}
+
+bool TileDecoder::Decompress(size_t* decompressed_size) {
+    InitBitReader();
+
+    uint32_t dst = 0;
+    bool done = false;
+    do {
+        // Block headers are read by the first lane
+        const uint32_t header = static_cast<uint32_t>(buf_[0]);
+        done = (header & 1) != 0;
+        const uint32_t btype = (header >> 1) & 3;
+        Eat(3, 1);
+
+        uint32_t counts[kNumLanes];
+        switch (btype) {
+            case 2: {
+                const uint32_t hlit = ((header >> 3) & 31) + 257;
+                const uint32_t hdist = ((header >> 8) & 31) + 1;
+                const uint32_t hclen = ((header >> 13) & 15) + 4;
+                Eat(14, 1);
+                if (!UnpackCodeLengths(hlit, hdist, hclen, counts) || !CompressedBlock(hlit, counts, &dst)) return false;
+                break;
+            }
+            case 1:
+                FixedCodeLengths(counts);
+                if (!CompressedBlock(288, counts, &dst)) return false;
+                break;
+            case 0: {
+                const uint32_t size = static_cast<uint32_t>(buf_[0]) & 0xffff;
+                Eat(16, 1);
+                if (!UncompressedBlock(size, &dst)) return false;
+                break;
+            }
+            default:
+                return false;
+        }
+        if (error_) return false;
+    } while (!done);
+
+    *decompressed_size = dst;
+    return true;
+}
+
+}  // namespace
+
+bool DecompressTile(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, size_t* decompressed_size) {
+    if (src == nullptr || dst == nullptr || decompressed_size == nullptr) return false;
+    TileDecoder decoder(src, src_size, dst, dst_size);
+    return decoder.Decompress(decompressed_size);
+}
+
+bool GetStreamInfo(const uint8_t* src, size_t src_size, StreamInfo* info) {
+    if (src == nullptr || src_size < kStreamHeaderSize || src[0] != kStreamId || src[1] != kStreamMagic) return false;
+
+    uint32_t header[2];
+    memcpy(header, src, sizeof(header));
+    info->num_tiles = header[0] >> 16;
+    const uint32_t last_tile_size = (header[1] >> 2) & 0x3ffff;
+    info->last_tile_size = last_tile_size == 0 ? kTileSize : last_tile_size;
+    info->data_offset = kStreamHeaderSize + sizeof(uint32_t) * info->num_tiles;
+    if (info->num_tiles == 0 || info->last_tile_size > kTileSize || info->data_offset > src_size) return false;
+    info->decompressed_size = static_cast<size_t>(info->num_tiles - 1) * kTileSize + info->last_tile_size;
+    return true;
+}
+
+// Decompresses one tile of a stream whose header GetStreamInfo parsed into info
+static bool DecompressStreamTile(const uint8_t* src, size_t src_size, const StreamInfo& info, uint32_t tile, uint8_t* dst) {
+    const auto offset = [src](uint32_t index) {
+        uint32_t value;
+        memcpy(&value, src + kStreamHeaderSize + sizeof(uint32_t) * index, sizeof(value));
+        return static_cast<size_t>(value);
+    };
+    const bool last = tile + 1 == info.num_tiles;
+    const size_t begin = tile == 0 ? 0 : offset(tile);
+    const size_t end = last ? begin + offset(0) : offset(tile + 1);
+    const size_t expected = last ? info.last_tile_size : kTileSize;
+    const size_t data_size = src_size - info.data_offset;
+    size_t decompressed = 0;
+    return end >= begin && end <= data_size &&
+           DecompressTile(src + info.data_offset + begin, end - begin, dst + static_cast<size_t>(tile) * kTileSize, expected,
+                          &decompressed) &&
+           decompressed == expected;
+}
+
+bool DecompressStream(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, uint32_t num_threads) {
+    StreamInfo info;
+    if (!GetStreamInfo(src, src_size, &info) || dst == nullptr || dst_size < info.decompressed_size) return false;
+
+    return internal::ParallelFor(info.num_tiles, num_threads,
+                                 [&](uint32_t tile) { return DecompressStreamTile(src, src_size, info, tile, dst); });
+}
+
+bool DecompressRegions(const HostRegion* regions, size_t count, bool streams, uint32_t num_threads) {
+    if (!streams) {
+        if (count > UINT32_MAX) return false;
+        return internal::ParallelFor(static_cast<uint32_t>(count), num_threads, [&](uint32_t index) {
+            const HostRegion& region = regions[index];
+            size_t decompressed = 0;
+            return region.dst != nullptr &&
+                   DecompressTile(region.src, region.src_size, region.dst, region.dst_size, &decompressed) &&
+                   decompressed == region.dst_size;
+        });
+    }
+
+    // Every tile of every stream is a work item, so threads that finish a short stream move on to the tiles of a long one
+    std::vector<StreamInfo> infos(count);
+    std::vector<std::pair<size_t, uint32_t>> tiles;
+    for (size_t i = 0; i < count; ++i) {
+        if (!GetStreamInfo(regions[i].src, regions[i].src_size, &infos[i]) || regions[i].dst == nullptr ||
+            infos[i].decompressed_size != regions[i].dst_size) {
+            return false;
+        }
+        for (uint32_t tile = 0; tile < infos[i].num_tiles; ++tile) {
+            tiles.emplace_back(i, tile);
+        }
+    }
+    if (tiles.size() > UINT32_MAX) return false;
+
+    return internal::ParallelFor(static_cast<uint32_t>(tiles.size()), num_threads, [&](uint32_t index) {
+        const size_t region = tiles[index].first;
+        return DecompressStreamTile(regions[region].src, regions[region].src_size, infos[region], tiles[index].second,
+                                    regions[region].dst);
+    });
+}
+
+}  // namespace gdeflate
@@ -0,0 +1,632 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#include "gdeflate.h"
+#include "gdeflate_internal.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace gdeflate {
+namespace {
+
+constexpr uint32_t kNumLitLenSymbols = 286;
+constexpr uint32_t kNumDistSymbols = 32;
+constexpr uint32_t kNumCodeLenSymbols = 19;
+constexpr uint32_t kEndOfBlock = 256;
+
+constexpr uint32_t kMaxCodeLen = 15;
+constexpr uint32_t kMaxCodeLenCodeLen = 7;
+
+constexpr uint32_t kMinMatch = 3;
+// Length symbol 285 is followed by 16 extra bits (Deflate64)
+constexpr uint32_t kMaxMatch = 3 + 0xffff;
+constexpr uint32_t kMaxStoredBlock = 0xffff;
+
+constexpr uint32_t kHashBits = 15;
+
+// Order in which code length code lengths are stored, one per lane
+const uint8_t kCodeLenOrder[kNumCodeLenSymbols] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+// Base lengths and extra bits of length symbols 257 to 284, longer matches use symbol 285
+const uint16_t kLengthBase[28] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23,
+                                  27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227};
+const uint8_t kLengthBits[28] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5};
+
+// Base distances and extra bits of distance symbols, including the two Deflate64 symbols
+const uint32_t kDistBase[kNumDistSymbols] = {1,    2,    3,    4,    5,    7,     9,     13,    17,    25,   33,
+                                             49,   65,   97,   129,  193,  257,   385,   513,   769,   1025, 1537,
+                                             2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577, 32769, 49153};
+const uint8_t kDistBits[kNumDistSymbols] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,  6,
+                                            7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14};
+
+struct LevelConfig {
+    uint32_t max_chain;    // Hash chain entries searched for a match
+    uint32_t nice_length;  // Match length which ends the search
+    bool lazy;             // Emit a literal if the next position has a longer match
+};
+
+const LevelConfig kLevels[kMaxLevel + 1] = {
+    {0, 0, false},      {4, 8, false},     {8, 16, false},     {16, 32, false},     {16, 32, true},
+    {32, 64, true},     {128, 128, true},  {256, 258, true},   {1024, 258, true},   {4096, 258, true},
+};
+
+// Literal when dist is zero, otherwise a match
+struct Token {
+    uint32_t value;
+    uint32_t dist;
+};
+
+// Code of a symbol plus its extra bits, in the order the decoder reads them
+struct Code {
+    uint32_t bits;
+    uint32_t len;
+};
+
+uint32_t LengthSymbol(uint32_t length) {
+    if (length > 258) return 285;
+    return 257 + static_cast<uint32_t>(std::upper_bound(kLengthBase, kLengthBase + 28, length) - kLengthBase) - 1;
+}
+
+uint32_t DistSymbol(uint32_t dist) {
+    return static_cast<uint32_t>(std::upper_bound(kDistBase, kDistBase + kNumDistSymbols, dist) - kDistBase) - 1;
+}
+
+uint32_t LengthExtraBits(uint32_t sym) { return sym == 285 ? 16 : kLengthBits[sym - 257]; }
+
+uint32_t LengthBase(uint32_t sym) { return sym == 285 ? 3 : kLengthBase[sym - 257]; }
+
+// Computes code lengths of at most max_len bits. At least two symbols get a code so that every code is complete.
+void BuildCodeLengths(const uint32_t* freq, uint32_t num_symbols, uint32_t max_len, uint8_t* lengths) {
+    std::fill(lengths, lengths + num_symbols, uint8_t(0));
+
+    std::vector<uint32_t> symbols;
+    for (uint32_t sym = 0; sym < num_symbols; ++sym) {
+        if (freq[sym] != 0) symbols.push_back(sym);
+    }
+    for (uint32_t sym = 0; symbols.size() < 2 && sym < num_symbols; ++sym) {
+        if (freq[sym] == 0) symbols.push_back(sym);
+    }
+    std::stable_sort(symbols.begin(), symbols.end(), [&](uint32_t a, uint32_t b) { return freq[a] < freq[b]; });
+
+    // Huffman tree over the sorted leaves, internal nodes are created in ascending weight order
+    const uint32_t n = static_cast<uint32_t>(symbols.size());
+    std::vector<uint64_t> weight(2 * n - 1);
+    std::vector<uint32_t> parent(2 * n - 1, 0);
+    for (uint32_t i = 0; i < n; ++i) {
+        weight[i] = freq[symbols[i]];
+    }
+    uint32_t leaf = 0;
+    uint32_t node = n;
+    for (uint32_t next = n; next < 2 * n - 1; ++next) {
+        uint32_t children[2];
+        for (uint32_t& child : children) {
+            child = (leaf < n && (node >= next || weight[leaf] <= weight[node])) ? leaf++ : node++;
+        }
+        weight[next] = weight[children[0]] + weight[children[1]];
+        parent[children[0]] = parent[children[1]] = next;
+    }
+
+    std::vector<uint32_t> depth(2 * n - 1, 0);
+    std::vector<uint32_t> num_codes(max_len + 1, 0);
+    for (uint32_t i = 2 * n - 1; i-- > 0;) {
+        if (i != 2 * n - 2) depth[i] = depth[parent[i]] + 1;
+        if (i < n) num_codes[std::min(depth[i], max_len)]++;
+    }
+
+    // Codes clamped to max_len oversubscribe the code space, lengthen shorter codes until it fits again
+    uint64_t total = 0;
+    for (uint32_t len = 1; len <= max_len; ++len) {
+        total += static_cast<uint64_t>(num_codes[len]) << (max_len - len);
+    }
+    while (total != (1ull << max_len)) {
+        num_codes[max_len]--;
+        for (uint32_t len = max_len - 1; len > 0; --len) {
+            if (num_codes[len] != 0) {
+                num_codes[len]--;
+                num_codes[len + 1] += 2;
+                break;
+            }
+        }
+        total--;
+    }
+
+    // The least frequent symbols get the longest codes
+    uint32_t i = 0;
+    for (uint32_t len = max_len; len > 0; --len) {
+        for (uint32_t j = 0; j < num_codes[len]; ++j) {
+            lengths[symbols[i++]] = static_cast<uint8_t>(len);
+        }
+    }
+}
+
+// Canonical codes, bit reversed as the decoder reads codes from their most significant bit
+void BuildCodes(const uint8_t* lengths, uint32_t num_symbols, uint32_t* codes) {
+    uint32_t count[kMaxCodeLen + 1] = {};
+    for (uint32_t sym = 0; sym < num_symbols; ++sym) {
+        count[lengths[sym]]++;
+    }
+    count[0] = 0;
+    uint32_t next[kMaxCodeLen + 1] = {};
+    uint32_t code = 0;
+    for (uint32_t len = 1; len <= kMaxCodeLen; ++len) {
+        code = (code + count[len - 1]) << 1;
+        next[len] = code;
+    }
+    for (uint32_t sym = 0; sym < num_symbols; ++sym) {
+        const uint32_t len = lengths[sym];
+        codes[sym] = len == 0 ? 0 : internal::BitReverse(next[len]++) >> (32 - len);
+    }
+}
+
+// Greedy or lazy LZ77 over a single tile, matches never reach into other tiles
+class MatchFinder {
+  public:
+    MatchFinder(const uint8_t* src, uint32_t size, const LevelConfig& config)
+        : src_(src), size_(size), config_(config), head_(1u << kHashBits, -1), prev_(size, -1) {}
+
+    void Run(std::vector<Token>* tokens) {
+        uint32_t pos = 0;
+        while (pos < size_) {
+            uint32_t dist = 0;
+            const uint32_t len = FindMatch(pos, &dist);
+            Insert(pos);
+
+            if (len >= kMinMatch && config_.lazy && len < config_.nice_length) {
+                uint32_t next_dist = 0;
+                if (FindMatch(pos + 1, &next_dist) > len) {
+                    tokens->push_back({src_[pos], 0});
+                    ++pos;
+                    continue;
+                }
+            }
+
+            if (len >= kMinMatch) {
+                tokens->push_back({len, dist});
+                for (uint32_t i = 1; i < len; ++i) {
+                    Insert(pos + i);
+                }
+                pos += len;
+            } else {
+                tokens->push_back({src_[pos], 0});
+                ++pos;
+            }
+        }
+    }
+
+  private:
+    uint32_t Hash(uint32_t pos) const {
+        const uint32_t value = src_[pos] | (src_[pos + 1] << 8) | (src_[pos + 2] << 16);
+        return (value * 2654435761u) >> (32 - kHashBits);
+    }
+
+    void Insert(uint32_t pos) {
+        if (pos + kMinMatch > size_) return;
+        const uint32_t hash = Hash(pos);
+        prev_[pos] = head_[hash];
+        head_[hash] = static_cast<int32_t>(pos);
+    }
+
+    uint32_t FindMatch(uint32_t pos, uint32_t* dist) const {
+        if (config_.max_chain == 0 || pos + kMinMatch > size_) return 0;
+        const uint32_t max_len = std::min(size_ - pos, kMaxMatch);
+        uint32_t best = kMinMatch - 1;
+        uint32_t chain = config_.max_chain;
+        for (int32_t candidate = head_[Hash(pos)]; candidate >= 0 && chain-- > 0; candidate = prev_[candidate]) {
+            const uint8_t* a = src_ + candidate;
+            const uint8_t* b = src_ + pos;
+            if (a[best] != b[best] || a[0] != b[0]) continue;
+            uint32_t len = 0;
+            while (len < max_len && a[len] == b[len]) {
+                ++len;
+            }
+            if (len > best) {
+                best = len;
+                *dist = pos - static_cast<uint32_t>(candidate);
+                if (len >= config_.nice_length || len == max_len) break;
+            }
+        }
+        return best >= kMinMatch ? best : 0;
+    }
+
+    const uint8_t* src_;
+    const uint32_t size_;
+    const LevelConfig& config_;
+    std::vector<int32_t> head_;
+    std::vector<int32_t> prev_;
+};
+
+// Spreads the bits of a tile over the 32 lane streams. Every Eat call mirrors an eat of the decoder, which hands out
+// the next words of the tile to the lanes left with less than 32 bits in lane order. Recording that order tells which
+// word of which lane goes where in the tile.
+class TileWriter {
+  public:
+    TileWriter() {
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            cnt_[lane] = 32;
+            schedule_.push_back(static_cast<uint8_t>(lane));
+        }
+    }
+
+    void Eat(const Code* codes, uint32_t lanes) {
+        uint32_t refill = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (lanes & (1u << lane)) {
+                Append(lane, codes[lane]);
+                cnt_[lane] -= codes[lane].len;
+                if (cnt_[lane] < 32) refill |= 1u << lane;
+            }
+        }
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (refill & (1u << lane)) {
+                schedule_.push_back(static_cast<uint8_t>(lane));
+                cnt_[lane] += 32;
+            }
+        }
+    }
+
+    void Eat(Code code, uint32_t lane) {
+        Code codes[kNumLanes];
+        codes[lane] = code;
+        Eat(codes, 1u << lane);
+    }
+
+    // Interleaves the lane streams, dropping trailing words which only the decoder's prefetching reads
+    void Finish(std::vector<uint8_t>* dst) {
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            if (acc_bits_[lane] != 0) words_[lane].push_back(static_cast<uint32_t>(acc_[lane]));
+        }
+        std::vector<uint32_t> tile;
+        tile.reserve(schedule_.size());
+        uint32_t next[kNumLanes] = {};
+        size_t size = 0;
+        for (const uint8_t lane : schedule_) {
+            const uint32_t index = next[lane]++;
+            if (index < words_[lane].size()) {
+                tile.push_back(words_[lane][index]);
+                size = tile.size();
+            } else {
+                tile.push_back(0);
+            }
+        }
+        const size_t offset = dst->size();
+        dst->resize(offset + size * sizeof(uint32_t));
+        memcpy(dst->data() + offset, tile.data(), size * sizeof(uint32_t));
+    }
+
+  private:
+    void Append(uint32_t lane, Code code) {
+        acc_[lane] |= static_cast<uint64_t>(code.bits) << acc_bits_[lane];
+        acc_bits_[lane] += code.len;
+        if (acc_bits_[lane] >= 32) {
+            words_[lane].push_back(static_cast<uint32_t>(acc_[lane]));
+            acc_[lane] >>= 32;
+            acc_bits_[lane] -= 32;
+        }
+    }
+
+    uint32_t cnt_[kNumLanes];
+    uint64_t acc_[kNumLanes] = {};
+    uint32_t acc_bits_[kNumLanes] = {};
+    std::vector<uint32_t> words_[kNumLanes];
+    std::vector<uint8_t> schedule_;
+};
+
+// Huffman codes of a block
+struct BlockCodes {
+    uint8_t lit_lengths[288];
+    uint32_t lit_codes[288];
+    uint8_t dist_lengths[kNumDistSymbols];
+    uint32_t dist_codes[kNumDistSymbols];
+};
+
+// Code length symbols describing the code lengths of a dynamic block
+struct CodeLengthSymbol {
+    uint32_t sym;
+    uint32_t extra;
+};
+
+struct DynamicHeader {
+    uint32_t hlit;
+    uint32_t hdist;
+    uint32_t hclen;
+    uint8_t lengths[kNumCodeLenSymbols];
+    uint32_t codes[kNumCodeLenSymbols];
+    std::vector<CodeLengthSymbol> symbols;
+};
+
+const uint8_t kCodeLenExtraBits[kNumCodeLenSymbols] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 7};
+
+// Run length codes the literal/length and distance code lengths
+void BuildDynamicHeader(const BlockCodes& codes, DynamicHeader* header) {
+    header->hlit = 257;
+    for (uint32_t sym = 0; sym < kNumLitLenSymbols; ++sym) {
+        if (codes.lit_lengths[sym] != 0) header->hlit = std::max(header->hlit, sym + 1);
+    }
+    header->hdist = 1;
+    for (uint32_t sym = 0; sym < kNumDistSymbols; ++sym) {
+        if (codes.dist_lengths[sym] != 0) header->hdist = sym + 1;
+    }
+
+    std::vector<uint8_t> lengths(codes.lit_lengths, codes.lit_lengths + header->hlit);
+    lengths.insert(lengths.end(), codes.dist_lengths, codes.dist_lengths + header->hdist);
+
+    header->symbols.clear();
+    for (size_t i = 0; i < lengths.size();) {
+        const uint8_t len = lengths[i];
+        size_t run = 1;
+        while (i + run < lengths.size() && lengths[i + run] == len) {
+            ++run;
+        }
+        size_t left = run;
+        if (len == 0) {
+            while (left >= 11) {
+                const uint32_t n = static_cast<uint32_t>(std::min<size_t>(left, 138));
+                header->symbols.push_back({18, n - 11});
+                left -= n;
+            }
+            if (left >= 3) {
+                header->symbols.push_back({17, static_cast<uint32_t>(left - 3)});
+                left = 0;
+            }
+        } else {
+            header->symbols.push_back({len, 0});
+            --left;
+            while (left >= 3) {
+                const uint32_t n = static_cast<uint32_t>(std::min<size_t>(left, 6));
+                header->symbols.push_back({16, n - 3});
+                left -= n;
+            }
+        }
+        for (; left > 0; --left) {
+            header->symbols.push_back({len, 0});
+        }
+        i += run;
+    }
+
+    uint32_t freq[kNumCodeLenSymbols] = {};
+    for (const CodeLengthSymbol& symbol : header->symbols) {
+        freq[symbol.sym]++;
+    }
+    BuildCodeLengths(freq, kNumCodeLenSymbols, kMaxCodeLenCodeLen, header->lengths);
+    BuildCodes(header->lengths, kNumCodeLenSymbols, header->codes);
+
+    header->hclen = 4;
+    for (uint32_t i = 0; i < kNumCodeLenSymbols; ++i) {
+        if (header->lengths[kCodeLenOrder[i]] != 0) header->hclen = std::max(header->hclen, i + 1);
+    }
+}
+
+void FixedCodes(BlockCodes* codes) {
+    std::fill(codes->lit_lengths, codes->lit_lengths + 144, uint8_t(8));
+    std::fill(codes->lit_lengths + 144, codes->lit_lengths + 256, uint8_t(9));
+    std::fill(codes->lit_lengths + 256, codes->lit_lengths + 280, uint8_t(7));
+    std::fill(codes->lit_lengths + 280, codes->lit_lengths + 288, uint8_t(8));
+    std::fill(codes->dist_lengths, codes->dist_lengths + kNumDistSymbols, uint8_t(5));
+    BuildCodes(codes->lit_lengths, 288, codes->lit_codes);
+    BuildCodes(codes->dist_lengths, kNumDistSymbols, codes->dist_codes);
+}
+
+// Size of the Huffman coded symbols of a block in bits
+uint64_t SymbolBits(const BlockCodes& codes, const uint32_t* lit_freq, const uint32_t* dist_freq) {
+    uint64_t bits = 0;
+    for (uint32_t sym = 0; sym < kNumLitLenSymbols; ++sym) {
+        bits += static_cast<uint64_t>(lit_freq[sym]) * (codes.lit_lengths[sym] + (sym > 256 ? LengthExtraBits(sym) : 0));
+    }
+    for (uint32_t sym = 0; sym < kNumDistSymbols; ++sym) {
+        bits += static_cast<uint64_t>(dist_freq[sym]) * (codes.dist_lengths[sym] + kDistBits[sym]);
+    }
+    return bits;
+}
+
+uint64_t HeaderBits(const DynamicHeader& header) {
+    uint64_t bits = 3 + 14 + 3 * header.hclen;
+    for (const CodeLengthSymbol& symbol : header.symbols) {
+        bits += header.lengths[symbol.sym] + kCodeLenExtraBits[symbol.sym];
+    }
+    return bits;
+}
+
+// Emits the code lengths of a dynamic block in rounds of 32 symbols (GInflate.glsl UnpackCodeLengths)
+void WriteDynamicHeader(const DynamicHeader& header, TileWriter* writer) {
+    writer->Eat({(header.hlit - 257) | ((header.hdist - 1) << 5) | ((header.hclen - 4) << 10), 14}, 0);
+
+    Code codes[kNumLanes];
+    for (uint32_t lane = 0; lane < header.hclen; ++lane) {
+        codes[lane] = {header.lengths[kCodeLenOrder[lane]], 3};
+    }
+    writer->Eat(codes, internal::LaneMask(header.hclen));
+
+    for (size_t i = 0; i < header.symbols.size(); i += kNumLanes) {
+        const uint32_t n = static_cast<uint32_t>(std::min<size_t>(header.symbols.size() - i, kNumLanes));
+        for (uint32_t lane = 0; lane < n; ++lane) {
+            const CodeLengthSymbol& symbol = header.symbols[i + lane];
+            const uint32_t len = header.lengths[symbol.sym];
+            codes[lane] = {header.codes[symbol.sym] | (symbol.extra << len), len + kCodeLenExtraBits[symbol.sym]};
+        }
+        writer->Eat(codes, internal::LaneMask(n));
+    }
+}
+
+// Emits Huffman coded symbols, each lane takes the next symbol unless it decodes the distance of its previous one
+// (GInflate.glsl CompressedBlock)
+void WriteSymbols(const BlockCodes& codes, const std::vector<Token>& tokens, TileWriter* writer) {
+    auto lit_code = [&](uint32_t sym, uint32_t extra) {
+        const uint32_t len = codes.lit_lengths[sym];
+        return Code{codes.lit_codes[sym] | (extra << len), len + (sym > 256 ? LengthExtraBits(sym) : 0)};
+    };
+
+    Code codes_this_round[kNumLanes];
+    Code dist_codes[kNumLanes];
+    uint32_t dist_lanes = 0;
+    size_t next = 0;
+    bool end_of_block = false;
+    while (true) {
+        uint32_t lanes = 0;
+        uint32_t next_dist_lanes = 0;
+        for (uint32_t lane = 0; lane < kNumLanes; ++lane) {
+            const uint32_t bit = 1u << lane;
+            if (dist_lanes & bit) {
+                codes_this_round[lane] = dist_codes[lane];
+                lanes |= bit;
+            } else if (!end_of_block) {
+                if (next == tokens.size()) {
+                    codes_this_round[lane] = lit_code(kEndOfBlock, 0);
+                    end_of_block = true;
+                } else {
+                    const Token& token = tokens[next++];
+                    if (token.dist == 0) {
+                        codes_this_round[lane] = lit_code(token.value, 0);
+                    } else {
+                        const uint32_t sym = LengthSymbol(token.value);
+                        codes_this_round[lane] = lit_code(sym, token.value - LengthBase(sym));
+                        const uint32_t dist_sym = DistSymbol(token.dist);
+                        const uint32_t len = codes.dist_lengths[dist_sym];
+                        dist_codes[lane] = {codes.dist_codes[dist_sym] | ((token.dist - kDistBase[dist_sym]) << len),
+                                            len + kDistBits[dist_sym]};
+                        next_dist_lanes |= bit;
+                    }
+                }
+                lanes |= bit;
+            }
+        }
+        writer->Eat(codes_this_round, lanes);
+        dist_lanes = next_dist_lanes;
+        if (end_of_block) break;
+    }
+
+    // Distances of the copies in the round holding the end of block symbol
+    writer->Eat(dist_codes, dist_lanes);
+}
+
+// Stored block, each lane supplies every 32nd byte
+void WriteStoredBlock(const uint8_t* src, uint32_t size, bool final, TileWriter* writer) {
+    writer->Eat({final ? 1u : 0u, 3}, 0);
+    writer->Eat({size, 16}, 0);
+    Code codes[kNumLanes];
+    for (uint32_t done = 0; done < size; done += kNumLanes) {
+        const uint32_t n = std::min(size - done, kNumLanes);
+        for (uint32_t lane = 0; lane < n; ++lane) {
+            codes[lane] = {src[done + lane], 8};
+        }
+        writer->Eat(codes, internal::LaneMask(n));
+    }
+}
+
+void WriteStoredBlocks(const uint8_t* src, uint32_t size, TileWriter* writer) {
+    uint32_t done = 0;
+    do {
+        const uint32_t n = std::min(size - done, kMaxStoredBlock);
+        WriteStoredBlock(src + done, n, done + n == size, writer);
+        done += n;
+    } while (done < size);
+}
+
+}  // namespace
+
+bool CompressTile(const uint8_t* src, size_t src_size, uint32_t level, std::vector<uint8_t>* dst) {
+    if ((src == nullptr && src_size != 0) || src_size > kTileSize || level > kMaxLevel || dst == nullptr) return false;
+    const uint32_t size = static_cast<uint32_t>(src_size);
+
+    TileWriter writer;
+    const uint64_t stored_bits = (size / kMaxStoredBlock + 1) * (3 + 16) + 8ull * size;
+    if (level == 0) {
+        WriteStoredBlocks(src, size, &writer);
+        writer.Finish(dst);
+        return true;
+    }
+
+    std::vector<Token> tokens;
+    tokens.reserve(size);
+    MatchFinder(src, size, kLevels[level]).Run(&tokens);
+
+    uint32_t lit_freq[288] = {};
+    uint32_t dist_freq[kNumDistSymbols] = {};
+    for (const Token& token : tokens) {
+        if (token.dist == 0) {
+            lit_freq[token.value]++;
+        } else {
+            lit_freq[LengthSymbol(token.value)]++;
+            dist_freq[DistSymbol(token.dist)]++;
+        }
+    }
+    lit_freq[kEndOfBlock] = 1;
+
+    BlockCodes dynamic_codes;
+    BuildCodeLengths(lit_freq, kNumLitLenSymbols, kMaxCodeLen, dynamic_codes.lit_lengths);
+    std::fill(dynamic_codes.lit_lengths + kNumLitLenSymbols, dynamic_codes.lit_lengths + 288, uint8_t(0));
+    BuildCodeLengths(dist_freq, kNumDistSymbols, kMaxCodeLen, dynamic_codes.dist_lengths);
+    BuildCodes(dynamic_codes.lit_lengths, 288, dynamic_codes.lit_codes);
+    BuildCodes(dynamic_codes.dist_lengths, kNumDistSymbols, dynamic_codes.dist_codes);
+    DynamicHeader header;
+    BuildDynamicHeader(dynamic_codes, &header);
+    const uint64_t dynamic_bits = HeaderBits(header) + SymbolBits(dynamic_codes, lit_freq, dist_freq);
+
+    BlockCodes fixed_codes;
+    FixedCodes(&fixed_codes);
+    const uint64_t fixed_bits = 3 + SymbolBits(fixed_codes, lit_freq, dist_freq);
+
+    if (stored_bits <= std::min(dynamic_bits, fixed_bits)) {
+        WriteStoredBlocks(src, size, &writer);
+    } else if (dynamic_bits < fixed_bits) {
+        writer.Eat({1 | (2 << 1), 3}, 0);
+        WriteDynamicHeader(header, &writer);
+        WriteSymbols(dynamic_codes, tokens, &writer);
+    } else {
+        writer.Eat({1 | (1 << 1), 3}, 0);
+        WriteSymbols(fixed_codes, tokens, &writer);
+    }
+    writer.Finish(dst);
+    return true;
+}
+
+bool CompressStream(const uint8_t* src, size_t src_size, uint32_t level, std::vector<uint8_t>* dst,
+                    std::vector<TileRegion>* regions, uint32_t num_threads) {
+    const size_t num_tiles = (src_size + kTileSize - 1) / kTileSize;
+    if (src == nullptr || dst == nullptr || num_tiles == 0 || num_tiles > 0xffff || level > kMaxLevel) return false;
+
+    std::vector<std::vector<uint8_t>> tiles(num_tiles);
+    const bool ok = internal::ParallelFor(static_cast<uint32_t>(num_tiles), num_threads, [&](uint32_t tile) {
+        const size_t offset = static_cast<size_t>(tile) * kTileSize;
+        return CompressTile(src + offset, std::min<size_t>(src_size - offset, kTileSize), level, &tiles[tile]);
+    });
+    if (!ok) return false;
+
+    // Tile offsets are relative to the end of the offset table, the first entry holds the size of the last tile
+    const uint32_t last_tile_size = static_cast<uint32_t>(src_size - (num_tiles - 1) * kTileSize);
+    std::vector<uint32_t> table(2 + num_tiles);
+    table[0] = kStreamId | (kStreamMagic << 8) | static_cast<uint32_t>(num_tiles << 16);
+    table[1] = 1 | ((last_tile_size == kTileSize ? 0 : last_tile_size) << 2);
+    table[2] = static_cast<uint32_t>(tiles.back().size());
+    size_t offset = 0;
+    for (size_t tile = 1; tile < num_tiles; ++tile) {
+        offset += tiles[tile - 1].size();
+        if (offset > 0xffffffff) return false;
+        table[2 + tile] = static_cast<uint32_t>(offset);
+    }
+
+    const size_t data_offset = table.size() * sizeof(uint32_t);
+    dst->resize(data_offset);
+    memcpy(dst->data(), table.data(), data_offset);
+    if (regions != nullptr) regions->clear();
+    for (size_t tile = 0; tile < num_tiles; ++tile) {
+        if (regions != nullptr) {
+            regions->push_back({dst->size(), tiles[tile].size(), tile * kTileSize,
+                                tile + 1 == num_tiles ? last_tile_size : kTileSize});
+        }
+        dst->insert(dst->end(), tiles[tile].begin(), tiles[tile].end());
+    }
+    return true;
+}
+
+}  // namespace gdeflate
@@ -0,0 +1,109 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#pragma once
+
+#include "gdeflate.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define GDEFLATE_NEON 1
+#endif
+
+namespace gdeflate {
+
+constexpr uint32_t kNumLanes = kNumStreams;
+constexpr uint32_t kAllLanes = 0xffffffff;
+
+namespace internal {
+
+inline uint32_t Mask(uint32_t n) { return n >= 32 ? 0xffffffff : (1u << n) - 1; }
+
+// Lanes numbered below n
+inline uint32_t LaneMask(uint32_t n) { return Mask(n); }
+
+inline uint32_t CountTrailingZeros(uint32_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    return _BitScanForward(&index, value) ? index : 32;
+#else
+    return value == 0 ? 32 : static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+
+// Index of the most significant set bit, ~0 for zero like GLSL findMSB
+inline uint32_t FindMsb(uint32_t value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    return _BitScanReverse(&index, value) ? index : ~0u;
+#else
+    return value == 0 ? ~0u : 31 - static_cast<uint32_t>(__builtin_clz(value));
+#endif
+}
+
+inline uint32_t BitReverse(uint32_t value) {
+    value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+    value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+    value = ((value >> 4) & 0x0f0f0f0f) | ((value & 0x0f0f0f0f) << 4);
+    value = ((value >> 8) & 0x00ff00ff) | ((value & 0x00ff00ff) << 8);
+    return (value >> 16) | (value << 16);
+}
+
+// Runs fn(i) for i in [0, count) on up to num_threads threads, zero using one thread per core. Stops handing out work
+// once fn returns false and returns false in that case.
+template <typename Fn>
+bool ParallelFor(uint32_t count, uint32_t num_threads, Fn&& fn) {
+    std::atomic<uint32_t> next{0};
+    std::atomic<bool> ok{true};
+    auto worker = [&]() {
+        for (uint32_t i = next++; i < count && ok; i = next++) {
+            if (!fn(i)) ok = false;
+        }
+    };
+
+    if (num_threads == 0) num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    num_threads = std::max(std::min(num_threads, count), 1u);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (uint32_t i = 1; i < num_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return ok;
+}
+
+// True if the AVX2 kernels can run on this CPU
+bool HasAvx2();
+
+// Removes n[lane] bits from the bit buffers of the given lanes, returns the lanes left with less than 32 bits
+uint32_t EatAvx2(uint64_t* buf, uint32_t* cnt, const uint32_t* n, uint32_t lanes);
+#if defined(GDEFLATE_NEON)
+uint32_t EatNeon(uint64_t* buf, uint32_t* cnt, const uint32_t* n, uint32_t lanes);
+#endif
+
+// Looks up the decoding table entries for the low lut_bits of each lane's bits, lanes in dist_lanes use the second table
+void GatherAvx2(const uint32_t* lut, uint32_t lut_bits, const uint32_t* bits, uint32_t dist_lanes, uint32_t* entries);
+
+}  // namespace internal
+}  // namespace gdeflate
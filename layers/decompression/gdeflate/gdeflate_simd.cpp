@@ -0,0 +1,134 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+#include "gdeflate_internal.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define GDEFLATE_X86_64 1
+#include <immintrin.h>
+#endif
+
+#if defined(GDEFLATE_NEON)
+#include <arm_neon.h>
+#endif
+
+// The AVX2 kernels are compiled for AVX2 regardless of the target architecture and only called after checking the CPU
+#if defined(GDEFLATE_X86_64) && (!defined(_MSC_VER) || defined(__clang__))
+#define GDEFLATE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define GDEFLATE_TARGET_AVX2
+#endif
+
+namespace gdeflate {
+namespace internal {
+
+#if defined(GDEFLATE_X86_64)
+
+bool HasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    static const bool has_avx2 = [] {
+        int info[4];
+        __cpuid(info, 1);
+        const bool os_saves_ymm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+    }();
+    return has_avx2;
+#else
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+#endif
+}
+
+GDEFLATE_TARGET_AVX2 uint32_t EatAvx2(uint64_t* buf, uint32_t* cnt, const uint32_t* n, uint32_t lanes) {
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i read_size = _mm256_set1_epi32(32);
+    uint32_t refill = 0;
+    for (uint32_t lane = 0; lane < kNumLanes; lane += 8) {
+        const __m256i active = _mm256_cmpeq_epi32(
+            _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(lanes >> lane)), lane_bits), lane_bits);
+
+        // Inactive lanes shift by zero
+        const __m256i amount = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(n + lane)), active);
+        const __m256i count = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cnt + lane)), amount);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(cnt + lane), count);
+
+        __m256i* buf_lo = reinterpret_cast<__m256i*>(buf + lane);
+        __m256i* buf_hi = reinterpret_cast<__m256i*>(buf + lane + 4);
+        _mm256_storeu_si256(buf_lo, _mm256_srlv_epi64(_mm256_loadu_si256(buf_lo),
+                                                      _mm256_cvtepu32_epi64(_mm256_castsi256_si128(amount))));
+        _mm256_storeu_si256(buf_hi, _mm256_srlv_epi64(_mm256_loadu_si256(buf_hi),
+                                                      _mm256_cvtepu32_epi64(_mm256_extracti128_si256(amount, 1))));
+
+        const __m256i low = _mm256_and_si256(_mm256_cmpgt_epi32(read_size, count), active);
+        refill |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(low))) << lane;
+    }
+    return refill;
+}
+
+GDEFLATE_TARGET_AVX2 void GatherAvx2(const uint32_t* lut, uint32_t lut_bits, const uint32_t* bits, uint32_t dist_lanes,
+                                     uint32_t* entries) {
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i index_mask = _mm256_set1_epi32(static_cast<int>((1u << lut_bits) - 1));
+    const __m256i table_size = _mm256_set1_epi32(static_cast<int>(1u << lut_bits));
+    for (uint32_t lane = 0; lane < kNumLanes; lane += 8) {
+        const __m256i dist = _mm256_cmpeq_epi32(
+            _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(dist_lanes >> lane)), lane_bits), lane_bits);
+        const __m256i index =
+            _mm256_add_epi32(_mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + lane)), index_mask),
+                             _mm256_and_si256(dist, table_size));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(entries + lane),
+                            _mm256_i32gather_epi32(reinterpret_cast<const int*>(lut), index, 4));
+    }
+}
+
+#else
+
+bool HasAvx2() { return false; }
+
+uint32_t EatAvx2(uint64_t*, uint32_t*, const uint32_t*, uint32_t) { return 0; }
+
+void GatherAvx2(const uint32_t*, uint32_t, const uint32_t*, uint32_t, uint32_t*) {}
+
+#endif
+
+#if defined(GDEFLATE_NEON)
+
+uint32_t EatNeon(uint64_t* buf, uint32_t* cnt, const uint32_t* n, uint32_t lanes) {
+    const uint32_t lane_bits_data[4] = {1, 2, 4, 8};
+    const uint32x4_t lane_bits = vld1q_u32(lane_bits_data);
+    const uint32x4_t read_size = vdupq_n_u32(32);
+    uint32_t refill = 0;
+    for (uint32_t lane = 0; lane < kNumLanes; lane += 4) {
+        const uint32x4_t active = vtstq_u32(vdupq_n_u32(lanes >> lane), lane_bits);
+
+        // Inactive lanes shift by zero
+        const uint32x4_t amount = vandq_u32(vld1q_u32(n + lane), active);
+        const uint32x4_t count = vsubq_u32(vld1q_u32(cnt + lane), amount);
+        vst1q_u32(cnt + lane, count);
+
+        // Right shifts are left shifts by negative amounts
+        const int64x2_t shift_lo = vnegq_s64(vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(amount))));
+        const int64x2_t shift_hi = vnegq_s64(vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(amount))));
+        vst1q_u64(buf + lane, vshlq_u64(vld1q_u64(buf + lane), shift_lo));
+        vst1q_u64(buf + lane + 2, vshlq_u64(vld1q_u64(buf + lane + 2), shift_hi));
+
+        const uint32x4_t low = vandq_u32(vcltq_u32(count, read_size), active);
+        refill |= vaddvq_u32(vandq_u32(low, lane_bits)) << lane;
+    }
+    return refill;
+}
+
+#endif
+
+}  // namespace internal
+}  // namespace gdeflate
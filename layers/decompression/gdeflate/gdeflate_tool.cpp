@@ -0,0 +1,268 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0 or MIT
+ *
+ * Licensed under either of
+ *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+ *   or
+ *   MIT license (http://opensource.org/licenses/MIT)
+ * at your option.
+ *
+ * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+ */
+
+// Command line front end of the GDeflate library: compresses and decompresses GDeflate streams, writes the region
+// tables vkCmdDecompressMemoryNV and vkCmdDecompressMemoryIndirectCountNV consume, generates test corpora and embeds
+// compressed files in C++ headers.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "gdeflate.h"
+
+static void PrintUsage() {
+    fprintf(stderr,
+            "usage: gdeflate compress [-l level] [-j threads] [-r regions] <input> <output>\n"
+            "       gdeflate decompress [-j threads] <input> <output>\n"
+            "       gdeflate generate [-s seed] <text|texture|mesh|random|incompressible> <size> <output>\n"
+            "       gdeflate embed [-l level] [-j threads] <name> <output> <input>...\n"
+            "\n"
+            "  -l level    compression level from %u (store) to %u, default %u\n"
+            "  -j threads  worker threads, default one per core\n"
+            "  -r regions  write a VkDecompressMemoryRegionNV per tile, with addresses relative to the\n"
+            "              compressed stream and the decompressed data\n"
+            "  -s seed     seed of the generated data, default 0\n"
+            "  size        bytes with an optional K, M or G suffix\n"
+            "  name        prefix of the arrays in the generated header, name[i] locates the stream of\n"
+            "              the i-th input in nameData\n",
+            gdeflate::kMinLevel, gdeflate::kMaxLevel, gdeflate::kDefaultLevel);
+}
+
+static bool ReadFile(const char* path, std::vector<uint8_t>* data) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        fprintf(stderr, "gdeflate: cannot open %s\n", path);
+        return false;
+    }
+    data->clear();
+    uint8_t buffer[64 * 1024];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data->insert(data->end(), buffer, buffer + read);
+    }
+    const bool ok = ferror(file) == 0;
+    fclose(file);
+    if (!ok) fprintf(stderr, "gdeflate: cannot read %s\n", path);
+    return ok;
+}
+
+static bool WriteFile(const char* path, const void* data, size_t size) {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        fprintf(stderr, "gdeflate: cannot create %s\n", path);
+        return false;
+    }
+    const bool ok = fwrite(data, 1, size, file) == size;
+    if (fclose(file) != 0 || !ok) {
+        fprintf(stderr, "gdeflate: cannot write %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+static bool ParseUint(const char* text, uint64_t max, uint64_t* value) {
+    char* end = nullptr;
+    const unsigned long long parsed = strtoull(text, &end, 10);
+    uint64_t scale = 1;
+    if (*end == 'K' || *end == 'k') scale = 1024;
+    if (*end == 'M' || *end == 'm') scale = 1024 * 1024;
+    if (*end == 'G' || *end == 'g') scale = 1024 * 1024 * 1024;
+    if (scale != 1) ++end;
+    if (end == text || *end != '\0' || parsed > max / scale) return false;
+    *value = parsed * scale;
+    return true;
+}
+
+static double Seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int Compress(const char* input, const char* output, uint32_t level, uint32_t num_threads, const char* regions_path) {
+    std::vector<uint8_t> data;
+    if (!ReadFile(input, &data)) return 1;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t> stream;
+    std::vector<gdeflate::TileRegion> tiles;
+    if (!gdeflate::CompressStream(data.data(), data.size(), level, &stream, &tiles, num_threads)) {
+        fprintf(stderr, "gdeflate: cannot compress %s, it must hold between 1 byte and 4 GiB\n", input);
+        return 1;
+    }
+    const double seconds = Seconds(start);
+
+    if (!WriteFile(output, stream.data(), stream.size())) return 1;
+
+    if (regions_path != nullptr) {
+        std::vector<VkDecompressMemoryRegionNV> regions;
+        for (const gdeflate::TileRegion& tile : tiles) {
+            regions.push_back({tile.src_offset, tile.dst_offset, tile.compressed_size, tile.decompressed_size,
+                               VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV});
+        }
+        if (!WriteFile(regions_path, regions.data(), regions.size() * sizeof(VkDecompressMemoryRegionNV))) return 1;
+    }
+
+    printf("%zu -> %zu bytes (%.3f) in %zu tiles, %.1f MB/s\n", data.size(), stream.size(),
+           static_cast<double>(stream.size()) / static_cast<double>(data.size()), tiles.size(),
+           static_cast<double>(data.size()) / 1e6 / seconds);
+    return 0;
+}
+
+static int Decompress(const char* input, const char* output, uint32_t num_threads) {
+    std::vector<uint8_t> stream;
+    if (!ReadFile(input, &stream)) return 1;
+
+    gdeflate::StreamInfo info;
+    if (!gdeflate::GetStreamInfo(stream.data(), stream.size(), &info)) {
+        fprintf(stderr, "gdeflate: %s is not a GDeflate stream\n", input);
+        return 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t> data(info.decompressed_size);
+    if (!gdeflate::DecompressStream(stream.data(), stream.size(), data.data(), data.size(), num_threads)) {
+        fprintf(stderr, "gdeflate: %s is corrupt\n", input);
+        return 1;
+    }
+    const double seconds = Seconds(start);
+
+    if (!WriteFile(output, data.data(), data.size())) return 1;
+    printf("%zu -> %zu bytes in %u tiles, %.1f MB/s\n", stream.size(), data.size(), info.num_tiles,
+           static_cast<double>(data.size()) / 1e6 / seconds);
+    return 0;
+}
+
+static int Generate(const char* corpus_name, const char* size_text, const char* output, uint32_t seed) {
+    gdeflate::Corpus corpus;
+    uint64_t size = 0;
+    if (!gdeflate::ParseCorpus(corpus_name, &corpus) || !ParseUint(size_text, SIZE_MAX, &size)) {
+        PrintUsage();
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    gdeflate::GenerateCorpus(corpus, static_cast<size_t>(size), seed, &data);
+    return WriteFile(output, data.data(), data.size()) ? 0 : 1;
+}
+
+static int Embed(const char* name, const char* output, const std::vector<const char*>& inputs, uint32_t level,
+                 uint32_t num_threads) {
+    std::vector<uint8_t> data;
+    std::vector<gdeflate::EmbeddedStream> entries;
+    std::vector<std::vector<uint8_t>> contents;
+    size_t total_size = 0;
+    size_t num_streams = 0;
+    for (const char* input : inputs) {
+        std::vector<uint8_t> file;
+        if (!ReadFile(input, &file)) return 1;
+        total_size += file.size();
+
+        // Identical inputs, such as shader variants that compile to the same code, share a stream
+        const auto same = std::find(contents.begin(), contents.end(), file);
+        if (same != contents.end()) {
+            entries.push_back(entries[same - contents.begin()]);
+        } else {
+            std::vector<uint8_t> stream;
+            if (!gdeflate::CompressStream(file.data(), file.size(), level, &stream, nullptr, num_threads)) {
+                fprintf(stderr, "gdeflate: cannot compress %s, it must hold between 1 byte and 4 GiB\n", input);
+                return 1;
+            }
+            entries.push_back({static_cast<uint32_t>(data.size()), static_cast<uint32_t>(stream.size()),
+                               static_cast<uint32_t>(file.size())});
+            data.insert(data.end(), stream.begin(), stream.end());
+            ++num_streams;
+        }
+        contents.push_back(std::move(file));
+    }
+
+    std::string text = "// Generated by gdeflate embed, do not edit\n\n#pragma once\n\n#include \"gdeflate.h\"\n\n";
+    text += "static const uint8_t " + std::string(name) + "Data[] = {";
+    char buffer[64];
+    for (size_t i = 0; i < data.size(); ++i) {
+        snprintf(buffer, sizeof(buffer), "%s0x%02x,", i % 16 == 0 ? "\n    " : "", data[i]);
+        text += buffer;
+    }
+    text += "\n};\n\nstatic const gdeflate::EmbeddedStream " + std::string(name) + "[] = {\n";
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const char* file_name = inputs[i];
+        for (const char* c = inputs[i]; *c != '\0'; ++c) {
+            if (*c == '/' || *c == '\\') file_name = c + 1;
+        }
+        snprintf(buffer, sizeof(buffer), "    {%u, %u, %u},  // ", entries[i].offset, entries[i].size,
+                 entries[i].decompressed_size);
+        text += buffer + std::string(file_name) + "\n";
+    }
+    text += "};\n";
+    if (!WriteFile(output, text.data(), text.size())) return 1;
+
+    printf("%zu -> %zu bytes (%.3f) in %zu streams\n", total_size, data.size(),
+           static_cast<double>(data.size()) / static_cast<double>(total_size), num_streams);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+    const char* command = argv[1];
+
+    uint64_t level = gdeflate::kDefaultLevel;
+    uint64_t num_threads = 0;
+    uint64_t seed = 0;
+    const char* regions_path = nullptr;
+    std::vector<const char*> args;
+    for (int i = 2; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "-l") == 0 && has_value) {
+            if (!ParseUint(argv[++i], gdeflate::kMaxLevel, &level)) {
+                PrintUsage();
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-j") == 0 && has_value) {
+            if (!ParseUint(argv[++i], UINT32_MAX, &num_threads)) {
+                PrintUsage();
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-s") == 0 && has_value) {
+            if (!ParseUint(argv[++i], UINT32_MAX, &seed)) {
+                PrintUsage();
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-r") == 0 && has_value) {
+            regions_path = argv[++i];
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (strcmp(command, "compress") == 0 && args.size() == 2) {
+        return Compress(args[0], args[1], static_cast<uint32_t>(level), static_cast<uint32_t>(num_threads), regions_path);
+    }
+    if (strcmp(command, "decompress") == 0 && args.size() == 2) {
+        return Decompress(args[0], args[1], static_cast<uint32_t>(num_threads));
+    }
+    if (strcmp(command, "generate") == 0 && args.size() == 3) {
+        return Generate(args[0], args[1], args[2], static_cast<uint32_t>(seed));
+    }
+    if (strcmp(command, "embed") == 0 && args.size() >= 3) {
+        const std::vector<const char*> inputs(args.begin() + 2, args.end());
+        return Embed(args[0], args[1], inputs, static_cast<uint32_t>(level), static_cast<uint32_t>(num_threads));
+    }
+    PrintUsage();
+    return 1;
+}
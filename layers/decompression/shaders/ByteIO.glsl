@@ -43,10 +43,35 @@ void Dst_StoreByte(uint index, uint byte)
     g_dst.data[index] = uint8_t(byte);
 }
 
+bool Dst_IsDwordAligned()
+{
+    return (uvec2(g_dst).x & 3) == 0;
+}
+
+// Dword access to the destination, which must be dword aligned
+uint Dst_ReadDword(uint index)
+{
+#ifdef GDEFLATE_BOUNDS_CHECK
+    if (index*4 > g_dstSize)
+        return 0;
+#endif
+    return BufferRef32(uvec2(g_dst)).data[index];
+}
+
+void Dst_StoreDword(uint index, uint data)
+{
+#ifdef GDEFLATE_BOUNDS_CHECK
+    if (index*4 > g_dstSize)
+        return;
+#endif
+    BufferRef32(uvec2(g_dst)).data[index] = data;
+}
+
 #else
 
 layout(std430, binding = 0) buffer inputLayout { uint g_Input[]; };
 layout(std430, binding = 1) buffer outputLayout { uint8_t g_Output[]; };
+layout(std430, binding = 1) buffer outputDwordLayout { uint g_OutputDwords[]; };
 
 uint Src_ReadByte(uint offset)
 {
@@ -72,4 +97,19 @@ void Dst_StoreByte(uint offset, uint data)
     g_Output[offset] = uint8_t(data);
 }
 
+bool Dst_IsDwordAligned()
+{
+    return true;
+}
+
+uint Dst_ReadDword(uint offset)
+{
+    return g_OutputDwords[offset];
+}
+
+void Dst_StoreDword(uint offset, uint data)
+{
+    g_OutputDwords[offset] = data;
+}
+
 #endif
@@ -296,6 +296,128 @@ int DecoderPair_decode(uint bits, out uint len, bool isdist) {
 	return int(SymbolTable_getSymbol(idx));
 }
 
+// Table-driven decoding, enabled by specializing the size of the lookup tables (in entries) to more than one.
+// Each decoder has a primary table indexed by the next kHuffmanLutBits bits of the stream, entries of longer codes
+// link to a secondary table indexed by the bits that follow. Secondary tables are allocated from a pool following
+// both primary tables, codes whose secondary table does not fit are left to the canonical decoder.
+layout(constant_id = 1) const uint kHuffmanLutSize = 1;
+const bool kHuffmanLut = kHuffmanLutSize > 1;
+
+const uint kHuffmanLutBits = 10;
+const uint kHuffmanLutRootSize = 1u << kHuffmanLutBits;
+const uint kHuffmanLutPoolBase = 2 * kHuffmanLutRootSize;
+const uint kHuffmanLutLink = 0x80000000;	// Link to a secondary table: bits << 16 | pool offset
+const uint kHuffmanLutSlow = 0xffffffff;	// Secondary table that did not fit in the pool
+
+// Entries hold len << 16 | symbol, or a link
+shared uint g_HuffmanLut[kHuffmanLutSize];
+
+// Reverse the order of the lower n bits
+uint HuffmanLut_reverse(uint value, uint n) {
+	return bitfieldReverse(value) >> (32 - n);
+}
+
+// Build the lookup tables of a decoder (base selects it) from its canonical code, allocating secondary tables in the
+// pool from poolBase. Returns the end of the pool space in use.
+uint HuffmanLut_init(uint base, uint poolBase) {
+	const uint kEntriesPerThread = kHuffmanLutRootSize / NUM_THREADS;
+	const uint kSubBits = kMaxCodeLen - kHuffmanLutBits;
+	uint lutBase = base == 0 ? 0 : kHuffmanLutRootSize;
+	uint symBase = base == 0 ? 0 : kDistanceCodesBase;
+	uint poolSize = kHuffmanLutSize - kHuffmanLutPoolBase;
+
+	// Size of the code space in use in units of the longest codes, incomplete codes leave the rest unused
+	uint limit = DecoderPair_getBaseCodes(kMaxCodeLen - 1 + base);
+	uint count = DecoderPair_getOffsets(kMaxCodeLen + base) - DecoderPair_getOffsets(kMaxCodeLen - 1 + base);
+	uint used = limit == 0xffffffff ? (1u << kMaxCodeLen) : (limit >> (32 - kMaxCodeLen)) + count;
+
+	// Each thread fills the entries of a contiguous range of prefixes in code order
+	uint poolNeeded = 0;
+	for (uint i = 0; i < kEntriesPerThread; i++) {
+		uint prefix = tid() * kEntriesPerThread + i;
+		uint first = prefix << kSubBits;
+
+		// Longest code with this prefix, codes only get longer in code order
+		uint code = min(first | mask(kSubBits), used - 1) << (32 - kMaxCodeLen);
+		uint len = DecoderPair_len4code(code, base);
+		uint id = min(DecoderPair_id4code(code, len, base) + symBase, kMaxSymbols - 1);
+		uint entry = (len << 16) | uint(SymbolTable_getSymbol(id));
+
+		if (first >= used) {
+			entry = kHuffmanLutBits << 16;	// Not a code
+		} else if (len > kHuffmanLutBits) {
+			entry = kHuffmanLutLink | ((len - kHuffmanLutBits) << 16);
+			poolNeeded += 1 << (len - kHuffmanLutBits);
+		}
+		g_HuffmanLut[lutBase + HuffmanLut_reverse(prefix, kHuffmanLutBits)] = entry;
+	}
+
+	// Long codes follow all shorter ones, so secondary tables are laid out in code order as well
+	uint offset = poolBase + scan(poolNeeded);
+	uint poolEnd = min(broadcast(offset + poolNeeded, NUM_THREADS - 1), poolSize);
+	for (uint i = 0; i < kEntriesPerThread; i++) {
+		uint prefix = tid() * kEntriesPerThread + i;
+		uint idx = lutBase + HuffmanLut_reverse(prefix, kHuffmanLutBits);
+		uint entry = g_HuffmanLut[idx];
+		if ((entry & kHuffmanLutLink) != 0) {
+			uint size = 1 << ((entry >> 16) & 0xff);
+			g_HuffmanLut[idx] = offset + size <= poolSize ? entry | offset : kHuffmanLutSlow;
+
+			// Record the prefix each pool entry belongs to
+			for (uint j = offset; j < min(offset + size, poolSize); j++)
+				g_HuffmanLut[kHuffmanLutPoolBase + j] = prefix;
+			offset += size;
+		}
+	}
+
+	barrier();
+
+	// Fill secondary tables, one pool entry per thread
+	for (uint i = poolBase; i < poolEnd; i += NUM_THREADS) {
+		uint slot = i + tid();
+		bool valid = slot < poolEnd;
+		uint prefix = valid ? g_HuffmanLut[kHuffmanLutPoolBase + slot] : 0;
+		uint link = g_HuffmanLut[lutBase + HuffmanLut_reverse(prefix, kHuffmanLutBits)];
+
+		// Secondary tables are indexed by the following bits in stream order, reverse them into code order
+		uint first = (prefix << kSubBits) | HuffmanLut_reverse(slot - (link & 0xffff), kSubBits);
+		uint code = min(first, used - 1) << (32 - kMaxCodeLen);
+		uint len = DecoderPair_len4code(code, base);
+		uint id = min(DecoderPair_id4code(code, len, base) + symBase, kMaxSymbols - 1);
+		uint entry = first < used ? (len << 16) | uint(SymbolTable_getSymbol(id)) : kMaxCodeLen << 16;
+
+		if (valid && link != kHuffmanLutSlow) g_HuffmanLut[kHuffmanLutPoolBase + slot] = entry;
+	}
+
+	barrier();
+
+	return poolEnd;
+}
+
+// Decode a huffman-coded symbol with the lookup tables
+int HuffmanLut_decode(uint bits, out uint len, bool isdist) {
+	uint entry = g_HuffmanLut[(isdist ? kHuffmanLutRootSize : 0) + (bits & mask(kHuffmanLutBits))];
+	if ((entry & kHuffmanLutLink) != 0 && entry != kHuffmanLutSlow) {
+		uint subBits = (entry >> 16) & 0xff;
+		entry = g_HuffmanLut[kHuffmanLutPoolBase + (entry & 0xffff) + ((bits >> kHuffmanLutBits) & mask(subBits))];
+	}
+
+	if (vote(entry == kHuffmanLutSlow) != 0) {
+		uint slowLen;
+		int sym = DecoderPair_decode(bits, slowLen, isdist);
+		if (entry == kHuffmanLutSlow) entry = (slowLen << 16) | uint(sym);
+	}
+
+	len = entry >> 16;
+	return int(entry & 0xffff);
+}
+
+// Decode a symbol of a compressed block
+int DecodeSymbol(uint bits, out uint len, bool isdist) {
+	if (kHuffmanLut) return HuffmanLut_decode(bits, len, isdist);
+	return DecoderPair_decode(bits, len, isdist);
+}
+
 // Calculate a histogram from in-register code lengths (each thread maps to a symbol)
 uint GetHistogram(uint cnt, uint len, uint maxlen) {
 	g_tmp[tid()] = 0;
@@ -393,6 +515,165 @@ uint UnpackCodeLengths(uint hlit, uint hdist, uint hclen) {
 	return g_tmp[tid()];
 }
 
+// Output staging: bytes are packed into dwords in shared memory and written to the destination buffer with aligned
+// dword stores once complete. The first staging dword holds output dword g_outBase, all output before it is in the
+// destination buffer. Rounds that do not fit, and destinations that are not dword aligned, store bytes directly.
+const uint kOutStageSize = 512;
+
+// One more dword than staged, reading 4 bytes may overrun the last one
+shared uint g_OutStage[kOutStageSize + 1];
+
+uint g_outBase;
+bool g_outStaged;
+
+void Out_init(uint dst) {
+	g_outBase = dst / 4;
+	g_outStaged = Dst_IsDwordAligned() && (dst & 3) == 0;
+	if (tid() == 0) g_OutStage[0] = 0;
+	barrier();
+}
+
+bool Out_fits(uint end) {
+	return (end + 3) / 4 - g_outBase <= kOutStageSize;
+}
+
+void Out_storeByte(uint pos, uint byte) {
+	atomicOr(g_OutStage[pos / 4 - g_outBase], byte << (8 * (pos & 3)));
+}
+
+// Store the lower n bytes of a dword at any position
+void Out_storeBytes(uint pos, uint bytes, uint n) {
+	uint i = pos / 4 - g_outBase;
+	uint shift = 8 * (pos & 3);
+	if (n < 4) bytes &= mask(8 * n);
+	atomicOr(g_OutStage[i], bytes << shift);
+	if ((pos & 3) + n > 4) atomicOr(g_OutStage[i + 1], bytes >> (32 - shift));
+}
+
+uint Out_readByte(uint pos) {
+	if (pos >= g_outBase * 4) return (g_OutStage[pos / 4 - g_outBase] >> (8 * (pos & 3))) & 0xff;
+	return uint(Dst_ReadByte(pos));
+}
+
+// Read 4 bytes of earlier output from any position
+uint Out_readBytes(uint pos) {
+	uint i = pos / 4;
+	uint shift = 8 * (pos & 3);
+	uint lo, hi = 0;
+	if (pos >= g_outBase * 4) {
+		lo = g_OutStage[i - g_outBase];
+		if (shift != 0) hi = g_OutStage[i + 1 - g_outBase];
+	} else if (pos + 4 <= g_outBase * 4) {
+		lo = Dst_ReadDword(i);
+		if (shift != 0) hi = Dst_ReadDword(i + 1);
+	} else {
+		// Straddles the staging buffer
+		return Out_readByte(pos) | (Out_readByte(pos + 1) << 8) | (Out_readByte(pos + 2) << 16) | (Out_readByte(pos + 3) << 24);
+	}
+	return shift == 0 ? lo : (lo >> shift) | (hi << (32 - shift));
+}
+
+// Write the complete dwords of output before pos and keep the last partial one staged
+void Out_flush(uint pos) {
+	if (!g_outStaged) return;
+
+	barrier();
+
+	uint n = pos / 4 - g_outBase;
+	for (uint i = tid(); i < n; i += NUM_THREADS) Dst_StoreDword(g_outBase + i, g_OutStage[i]);
+	barrier();
+
+	if (tid() == 0 && n != 0) g_OutStage[0] = g_OutStage[n];
+	g_outBase += n;
+	memoryBarrierBuffer();
+	barrier();
+}
+
+// Write the staged output before pos with byte stores, before output goes directly to the destination buffer
+void Out_spill(uint pos) {
+	if (!g_outStaged) return;
+
+	Out_flush(pos);
+	if (tid() < (pos & 3)) Dst_StoreByte(g_outBase * 4 + tid(), Out_readByte(g_outBase * 4 + tid()));
+	memoryBarrierBuffer();
+	barrier();
+}
+
+// Stage the last partial dword of output stored directly to the destination buffer
+void Out_reload(uint pos) {
+	if (!g_outStaged) return;
+
+	memoryBarrierBuffer();
+	barrier();
+
+	g_outBase = pos / 4;
+	if (tid() == 0) {
+		uint bytes = 0;
+		for (uint i = 0; i < (pos & 3); i++) bytes |= uint(Dst_ReadByte(g_outBase * 4 + i)) << (8 * i);
+		g_OutStage[0] = bytes;
+	}
+	barrier();
+}
+
+// Prepare output of [pos, end), returns false if it has to be stored directly to the destination buffer
+bool Out_begin(uint pos, uint end) {
+	if (!g_outStaged) return false;
+
+	if (!Out_fits(end)) Out_flush(pos);
+	if (!Out_fits(end)) {
+		Out_spill(pos);
+		return false;
+	}
+
+	// Clear the dwords past the one holding pos, which is already partially filled or clear
+	uint first = (pos + 3) / 4 - g_outBase;
+	uint last = (end + 3) / 4 - g_outBase;
+	for (uint i = first + tid(); i < last; i += NUM_THREADS) g_OutStage[i] = 0;
+	barrier();
+	return true;
+}
+
+void Out_end(bool staged, uint end) {
+	if (!staged) Out_reload(end);
+}
+
+// Write all remaining output
+void Out_finish(uint end) {
+	Out_spill(end);
+}
+
+// Fill in copy destinations staged in shared memory. Each thread copies 4 consecutive bytes at a time, reading them
+// with one unaligned load when they do not wrap around the distance, as is always the case for distances from 4.
+void Out_copy(uint dst, uint dist, uint len, bool p) {
+	uint mask = vote(p);
+
+	while (mask != 0) {
+		uint lane = findLSB(mask);
+
+		uint offset = broadcast(dist, lane);
+		uint length = broadcast(len, lane);
+		uint outPos = broadcast(dst, lane);
+
+		for (uint i = 4 * tid(); i < length; i += 4 * NUM_THREADS) {
+			uint n = min(length - i, 4u);
+			uint src = i % offset;
+			uint bytes;
+			if (src + n <= offset) {
+				bytes = Out_readBytes(outPos - offset + src);
+			} else {
+				bytes = 0;
+				for (uint j = 0; j < n; j++) bytes |= Out_readByte(outPos + (i + j) % offset - offset) << (8 * j);
+			}
+			Out_storeBytes(outPos + i, bytes, n);
+		}
+
+		// Later copies may read this one
+		barrier();
+
+		mask &= mask - 1;
+	}
+}
+
 void Copy(uint dst, uint dist, uint len, bool p) {
 	const uint kMaxWideCopyLen = 16;
 
@@ -418,12 +699,23 @@ void Copy(uint dst, uint dist, uint len, bool p) {
 
 // Output literals and copies
 void CoalesceOutput(uint dst, uint offset, uint dist, uint length, uint byte, bool iscopy) {
+	uint end = dst + broadcast(offset + length, NUM_THREADS - 1);
+	bool staged = Out_begin(dst, end);
 	dst += offset;
-	// Output literals
-	if (!iscopy && length != 0) Dst_StoreByte(dst, byte);
 
-	// Fill in copy destinations
-	Copy(dst, dist, length, iscopy);
+	if (staged) {
+		// Output literals
+		if (!iscopy && length != 0) Out_storeByte(dst, byte);
+		barrier();
+
+		// Fill in copy destinations
+		Out_copy(dst, dist, length, iscopy);
+	} else {
+		if (!iscopy && length != 0) Dst_StoreByte(dst, byte);
+		Copy(dst, dist, length, iscopy);
+	}
+
+	Out_end(staged, end);
 }
 
 // Translate a symbol to its value
@@ -465,6 +757,11 @@ uint CompressedBlock(uint hlit, uint counts, uint dst) {
 	DecoderPair_init(counts, 15);
 	SymbolTable_init(hlit, DecoderPair_getOffsets(tid()));
 
+	if (kHuffmanLut) {
+		barrier();	// Symbol table is complete, previous block is done with the lookup tables
+		HuffmanLut_init(16, HuffmanLut_init(0, 0));
+	}
+
 #ifdef GDEFLATE_ENABLE_DEFLATE64
 	const uint kMaxCodeBits = 15 + 16;
 #else
@@ -473,7 +770,7 @@ uint CompressedBlock(uint hlit, uint counts, uint dst) {
 
 	// Initial round - no copy processing
 	uint len = 0;
-	int sym = DecoderPair_decode(BitReader_peek(kMaxCodeBits), len, false); // Initial round can't contain distance symbols
+	int sym = DecodeSymbol(BitReader_peek(kMaxCodeBits), len, false); // Initial round can't contain distance symbols
 
 	uint eob = vote(sym == 256);
 	bool oob = (eob & ltMask()) != 0;
@@ -490,7 +787,7 @@ uint CompressedBlock(uint hlit, uint counts, uint dst) {
 
 	// .. for all symbols in the block
 	while (eob == 0) {
-		sym = DecoderPair_decode(BitReader_peek(kMaxCodeBits), len, iscopy);
+		sym = DecodeSymbol(BitReader_peek(kMaxCodeBits), len, iscopy);
 
 		// Set predicates based on the current symbol
 		eob = vote(sym == 256);	// end of block symbol
@@ -512,7 +809,7 @@ uint CompressedBlock(uint hlit, uint counts, uint dst) {
 	}
 
 	// One last round of copy processing
-	sym = DecoderPair_decode(BitReader_peek(kMaxCodeBits), len, true);
+	sym = DecodeSymbol(BitReader_peek(kMaxCodeBits), len, true);
 
 	iscopy = iscopy && !oob;
 	uint dist = TranslateSymbol(sym, len, BitReader_peek(), iscopy, false);
@@ -527,7 +824,11 @@ uint UncompressedBlock(uint dst, uint size) {
 
 	// Full rounds with no bounds checking
 	while (nrounds-- > 0) {
-		Dst_StoreByte(dst + tid(), BitReader_read(8, true));
+		bool staged = Out_begin(dst, dst + NUM_THREADS);
+		uint byte = BitReader_read(8, true);
+		if (staged) Out_storeByte(dst + tid(), byte);
+		else Dst_StoreByte(dst + tid(), byte);
+		Out_end(staged, dst + NUM_THREADS);
 		dst += NUM_THREADS;
 	}
 
@@ -535,8 +836,13 @@ uint UncompressedBlock(uint dst, uint size) {
 
 	// Last partial round with bounds check
 	if (rem != 0) {
+		bool staged = Out_begin(dst, dst + rem);
 		uint byte = BitReader_read(8, tid() < rem);
-		if (tid() < rem) Dst_StoreByte(dst + tid(), byte);
+		if (tid() < rem) {
+			if (staged) Out_storeByte(dst + tid(), byte);
+			else Dst_StoreByte(dst + tid(), byte);
+		}
+		Out_end(staged, dst + rem);
 		dst += rem;
 	}
 
@@ -557,6 +863,7 @@ void DecompressTile() {
 
 	// Init bit reader
 	BitReader_init(g_srcPos);
+	Out_init(dst);
 
 	bool done;
 
@@ -594,6 +901,8 @@ void DecompressTile() {
 		}
 
 	} while (!done);
+
+	Out_finish(dst);
 }
 
 #define DECOMPRESS_TILE DecompressTile
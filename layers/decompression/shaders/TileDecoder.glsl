@@ -49,23 +49,34 @@ layout(buffer_reference) buffer BufferRef8 { uint8_t data[]; };
 
 #if defined(GDEFLATE_INDIRECT_DECOMPRESS)
 
-struct VkDecompressMemoryCommandNV
+// VkDecompressMemoryRegionEXT, which VkDecompressMemoryRegionNV starts with. The decompressionMethod the NV region
+// adds is not read, so commands of both extensions are loaded with their stride.
+struct DecompressMemoryCommand
 {
     uvec2 srcAddress;
     uvec2 dstAddress;
     uvec2 compressedSize;
     uvec2 decompressedSize;
-    uvec2 decompressionMethod;
 };
 
-layout(buffer_reference) buffer BufferRef { VkDecompressMemoryCommandNV data; };
+layout(buffer_reference) buffer BufferRef { DecompressMemoryCommand data; };
 
 layout(push_constant) uniform constants
 {
     uvec2 decompressionParamsAddr;
     uint stride;
+    // Upper bound of the command count read from countAddr
+    uint maxCount;
+    // Address of the command count, zero when there is one command per workgroup of the dispatch
+    uvec2 countAddr;
 } cbParams;
 
+// Commands hold whole GDeflate streams instead of a single raw tile
+layout(constant_id = 0) const bool kStreamFormat = false;
+
+// Size of the data a GDeflate tile decompresses to, all tiles of a stream but the last one have this size
+#define GDEFLATE_TILE_SIZE 65536u
+
 #else
 
 layout(push_constant) uniform constants
@@ -74,7 +85,6 @@ layout(push_constant) uniform constants
     uvec2 dstAddress;
     uvec2 compressedSize;
     uvec2 decompressedSize;
-    uvec2 decompressionMethod;
 } cbParams;
 
 #endif
@@ -94,22 +104,95 @@ shared uint g_tmp[NUM_THREADS];
 #include "ByteIO.glsl"
 #include "GInflate.glsl"
 
-void main()
-{
 #if defined(GDEFLATE_INDIRECT_DECOMPRESS)
-    const uint i = gl_WorkGroupID.x;
-    uvec2 paramsAddrs;
+
+uvec2 AddOffset(uvec2 addr, uint offset)
+{
     uint carry = 0;
-    paramsAddrs.x = uaddCarry(cbParams.decompressionParamsAddr.x, cbParams.stride * i, carry);
-    paramsAddrs.y = cbParams.decompressionParamsAddr.y + carry;
-    BufferRef paramsAddress = BufferRef(paramsAddrs);
-    g_src = BufferRef32(paramsAddress.data.srcAddress);
-    g_dst = BufferRef8(paramsAddress.data.dstAddress);
-    g_srcSize = uint(paramsAddress.data.compressedSize);
-    g_dstSize = uint(paramsAddress.data.decompressedSize);
-    g_dstPos = 0;
+    addr.x = uaddCarry(addr.x, offset, carry);
+    addr.y += carry;
+    return addr;
+}
+
+DecompressMemoryCommand LoadCommand(uint i)
+{
+    return BufferRef(AddOffset(cbParams.decompressionParamsAddr, cbParams.stride * i)).data;
+}
+
+// Decompresses one tile of a GDeflate stream. The stream starts with an 8 byte header holding the tile count and the size
+// of the last tile, followed by a table of tile offsets relative to the end of the table. The first table entry holds
+// the compressed size of the last tile instead, as the first tile always starts at offset zero. Tiles must be dword aligned.
+void DecompressStreamTile(DecompressMemoryCommand cmd, uint tileIndex)
+{
+    BufferRef32 stream = BufferRef32(cmd.srcAddress);
+    const uint header0 = stream.data[0];
+    const uint numTiles = header0 >> 16;
+    // Identifier 4 followed by its complement 0xFB
+    if ((header0 & 0xFFFF) != 0xFB04 || tileIndex >= numTiles)
+    {
+        return;
+    }
+    const uint lastTileSize = (stream.data[1] >> 2) & 0x3FFFF;
+    const uint tileOffset = tileIndex == 0 ? 0 : stream.data[2 + tileIndex];
+    const bool lastTile = tileIndex + 1 == numTiles;
+
+    g_src = BufferRef32(AddOffset(cmd.srcAddress, 8 + numTiles * 4 + tileOffset));
+    g_dst = BufferRef8(AddOffset(cmd.dstAddress, tileIndex * GDEFLATE_TILE_SIZE));
+    g_srcSize = lastTile ? stream.data[2] : stream.data[3 + tileIndex] - tileOffset;
+    g_dstSize = lastTile && lastTileSize != 0 ? lastTileSize : GDEFLATE_TILE_SIZE;
+    g_dstSize = min(g_dstSize, uint(cmd.decompressedSize) - tileIndex * GDEFLATE_TILE_SIZE);
     g_srcPos = 0;
+    g_dstPos = 0;
     DECOMPRESS_TILE();
+}
+
+#endif
+
+void main()
+{
+#if defined(GDEFLATE_INDIRECT_DECOMPRESS)
+    // The grid is sized for occupancy rather than for the command count, so workgroups loop over the commands by grid
+    // stride. Reading the count here avoids a separate pass writing indirect dispatch arguments.
+    uint count = gl_NumWorkGroups.x;
+    if (cbParams.countAddr != uvec2(0))
+    {
+        count = min(BufferRef32(cbParams.countAddr).data[0], cbParams.maxCount);
+    }
+    if (kStreamFormat)
+    {
+        // Tiles of all commands are numbered consecutively and dealt out to the workgroups round robin, so a single
+        // stream is decompressed by many workgroups. The tile count is derived from the decompressed size to avoid
+        // reading every stream header here.
+        const uint gridSize = gl_NumWorkGroups.x;
+        uint firstTile = 0;
+        for (uint i = 0; i < count; ++i)
+        {
+            DecompressMemoryCommand cmd = LoadCommand(i);
+            const uint numTiles = (uint(cmd.decompressedSize) + GDEFLATE_TILE_SIZE - 1) / GDEFLATE_TILE_SIZE;
+            for (uint t = (gl_WorkGroupID.x + gridSize - firstTile % gridSize) % gridSize; t < numTiles; t += gridSize)
+            {
+                DecompressStreamTile(cmd, t);
+                // Shared memory is reused by the next tile
+                barrier();
+            }
+            firstTile += numTiles;
+        }
+        return;
+    }
+
+    for (uint i = gl_WorkGroupID.x; i < count; i += gl_NumWorkGroups.x)
+    {
+        DecompressMemoryCommand cmd = LoadCommand(i);
+        g_src = BufferRef32(cmd.srcAddress);
+        g_dst = BufferRef8(cmd.dstAddress);
+        g_srcSize = uint(cmd.compressedSize);
+        g_dstSize = uint(cmd.decompressedSize);
+        g_dstPos = 0;
+        g_srcPos = 0;
+        DECOMPRESS_TILE();
+        // Shared memory is reused by the next command
+        barrier();
+    }
 #else
     g_src = BufferRef32(cbParams.srcAddress);
     g_dst = BufferRef8(cbParams.dstAddress);
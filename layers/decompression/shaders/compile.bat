@@ -13,39 +13,80 @@
 :: Author: Ilya Terentiev <iterentiev@nvidia.com>
 :: Author: Vikram Kushwaha <vkushwaha@nvidia.com>
 
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. --vn copyCount -o spirv\copyCount_vk.h copyCount.glsl
+if not defined GDEFLATE set GDEFLATE=gdeflate
+if not exist spirv\tmp mkdir spirv\tmp
 
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DNONE --vn kGInflate8 -o spirv\GInflate8_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16  --vn kGInflate8_HAVE_INT16 -o spirv\GInflate8_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT64  --vn kGInflate8_HAVE_INT64 -o spirv\GInflate8_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kGInflate8_HAVE_INT16_HAVE_INT64 -o spirv\GInflate8_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DNONE --vn kGInflate16 -o spirv\GInflate16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16  --vn kGInflate16_HAVE_INT16 -o spirv\GInflate16_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT64  --vn kGInflate16_HAVE_INT64 -o spirv\GInflate16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kGInflate16_HAVE_INT16_HAVE_INT64 -o spirv\GInflate16_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DNONE --vn kGInflate32 -o spirv\GInflate32_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16  --vn kGInflate32_HAVE_INT16 -o spirv\GInflate32_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT64  --vn kGInflate32_HAVE_INT64 -o spirv\GInflate32_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kGInflate32_HAVE_INT16_HAVE_INT64 -o spirv\GInflate32_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DNONE --vn kGInflate64 -o spirv\GInflate64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16  --vn kGInflate64_HAVE_INT16 -o spirv\GInflate64_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT64  --vn kGInflate64_HAVE_INT64 -o spirv\GInflate64_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kGInflate64_HAVE_INT16_HAVE_INT64 -o spirv\GInflate64_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
+:: The layer selects variant SIMD width + 4 * int16 + 8 * int64 of the direct shaders and the same one of the
+:: indirect shaders, which follow them. Keep this order.
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DNONE -o spirv\tmp\GInflate8.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DNONE -o spirv\tmp\GInflate16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DNONE -o spirv\tmp\GInflate32.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DNONE -o spirv\tmp\GInflate64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\GInflate8_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\GInflate16_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\GInflate32_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\GInflate64_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate8_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate32_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate64_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate8_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate16_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate32_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\GInflate64_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
 
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DNONE --vn kIndirectGInflate8 -o spirv\IndirectGInflate8_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16  --vn kIndirectGInflate8_HAVE_INT16 -o spirv\IndirectGInflate8_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate8_HAVE_INT64 -o spirv\IndirectGInflate8_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate8_HAVE_INT16_HAVE_INT64 -o spirv\IndirectGInflate8_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DNONE --vn kIndirectGInflate16 -o spirv\IndirectGInflate16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16  --vn kIndirectGInflate16_HAVE_INT16 -o spirv\IndirectGInflate16_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate16_HAVE_INT64 -o spirv\IndirectGInflate16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate16_HAVE_INT16_HAVE_INT64 -o spirv\IndirectGInflate16_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DNONE --vn kIndirectGInflate32 -o spirv\IndirectGInflate32_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16  --vn kIndirectGInflate32_HAVE_INT16 -o spirv\IndirectGInflate32_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate32_HAVE_INT64 -o spirv\IndirectGInflate32_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate32_HAVE_INT16_HAVE_INT64 -o spirv\IndirectGInflate32_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DNONE --vn kIndirectGInflate64 -o spirv\IndirectGInflate64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16  --vn kIndirectGInflate64_HAVE_INT16 -o spirv\IndirectGInflate64_HAVE_INT16_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate64_HAVE_INT64 -o spirv\IndirectGInflate64_HAVE_INT64_vk.h TileDecoder.glsl
-glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -DGDEFLATE_INDIRECT_DECOMPRESS -I. -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64  --vn kIndirectGInflate64_HAVE_INT16_HAVE_INT64 -o spirv\IndirectGInflate64_HAVE_INT16_HAVE_INT64_vk.h TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DNONE -o spirv\tmp\IndirectGInflate8.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DNONE -o spirv\tmp\IndirectGInflate16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DNONE -o spirv\tmp\IndirectGInflate32.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DNONE -o spirv\tmp\IndirectGInflate64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\IndirectGInflate8_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\IndirectGInflate16_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\IndirectGInflate32_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -o spirv\tmp\IndirectGInflate64_HAVE_INT16.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate8_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate32_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate64_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=8 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate8_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=16 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate16_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=32 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate32_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
+glslangValidator --target-env vulkan1.2 -g0 -S comp -e main -I. -DGDEFLATE_INDIRECT_DECOMPRESS -DGDEFLATE_USING_BUFFER_REF -DSIMD_WIDTH=64 -DGDEFLATE_HAVE_INT16 -DGDEFLATE_HAVE_INT64 -o spirv\tmp\IndirectGInflate64_HAVE_INT16_HAVE_INT64.spv TileDecoder.glsl
 
+:: Variants are embedded as GDeflate streams the layer decompresses on device creation, identical ones are stored once
+%GDEFLATE% embed -l 9 kGInflateSpirv spirv\GInflate_vk.h ^
+    spirv\tmp\GInflate8.spv ^
+    spirv\tmp\GInflate16.spv ^
+    spirv\tmp\GInflate32.spv ^
+    spirv\tmp\GInflate64.spv ^
+    spirv\tmp\GInflate8_HAVE_INT16.spv ^
+    spirv\tmp\GInflate16_HAVE_INT16.spv ^
+    spirv\tmp\GInflate32_HAVE_INT16.spv ^
+    spirv\tmp\GInflate64_HAVE_INT16.spv ^
+    spirv\tmp\GInflate8_HAVE_INT64.spv ^
+    spirv\tmp\GInflate16_HAVE_INT64.spv ^
+    spirv\tmp\GInflate32_HAVE_INT64.spv ^
+    spirv\tmp\GInflate64_HAVE_INT64.spv ^
+    spirv\tmp\GInflate8_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\GInflate16_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\GInflate32_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\GInflate64_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate8.spv ^
+    spirv\tmp\IndirectGInflate16.spv ^
+    spirv\tmp\IndirectGInflate32.spv ^
+    spirv\tmp\IndirectGInflate64.spv ^
+    spirv\tmp\IndirectGInflate8_HAVE_INT16.spv ^
+    spirv\tmp\IndirectGInflate16_HAVE_INT16.spv ^
+    spirv\tmp\IndirectGInflate32_HAVE_INT16.spv ^
+    spirv\tmp\IndirectGInflate64_HAVE_INT16.spv ^
+    spirv\tmp\IndirectGInflate8_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate16_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate32_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate64_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate8_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate16_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate32_HAVE_INT16_HAVE_INT64.spv ^
+    spirv\tmp\IndirectGInflate64_HAVE_INT16_HAVE_INT64.spv
+rmdir /s /q spirv\tmp
+
+:: Record which GLSL the header was generated from, the tests fail when the two drift apart
+cmake -DUPDATE=ON -P glsl_checksum.cmake
@@ -0,0 +1,51 @@
+# ~~~
+# Copyright (c) 2026 The Khronos Group Inc.
+# SPDX-License-Identifier: Apache-2.0 or MIT
+#
+# Licensed under either of
+#   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
+#   or
+#   MIT license (http://opensource.org/licenses/MIT)
+# at your option.
+#
+# Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
+# ~~~
+
+# Keeps spirv/GInflate_vk.h in step with the GLSL it was generated from. The header records a checksum of the *.glsl
+# sources; "cmake -DUPDATE=ON -P glsl_checksum.cmake" rewrites it after compile.sh or compile.bat and a plain
+# "cmake -P glsl_checksum.cmake" fails when a shader was changed without regenerating the SPIR-V.
+
+set(SHADER_DIR ${CMAKE_CURRENT_LIST_DIR})
+set(HEADER ${SHADER_DIR}/spirv/GInflate_vk.h)
+set(CHECKSUM_PREFIX "// GLSL sources SHA-256: ")
+
+file(GLOB GLSL_FILES RELATIVE ${SHADER_DIR} ${SHADER_DIR}/*.glsl)
+list(SORT GLSL_FILES)
+set(GLSL_SOURCES "")
+foreach(GLSL_FILE IN LISTS GLSL_FILES)
+    file(READ ${SHADER_DIR}/${GLSL_FILE} GLSL_SOURCE)
+    # Line endings depend on the checkout, the checksum must not
+    string(REPLACE "\r" "" GLSL_SOURCE "${GLSL_SOURCE}")
+    string(APPEND GLSL_SOURCES "${GLSL_FILE}\n${GLSL_SOURCE}")
+endforeach()
+string(SHA256 GLSL_CHECKSUM "${GLSL_SOURCES}")
+
+file(READ ${HEADER} HEADER_SOURCE)
+string(REPLACE "\r" "" HEADER_SOURCE "${HEADER_SOURCE}")
+
+if (UPDATE)
+    string(REGEX REPLACE "${CHECKSUM_PREFIX}[0-9a-f]*\n" "" HEADER_SOURCE "${HEADER_SOURCE}")
+    string(FIND "${HEADER_SOURCE}" "// Generated by gdeflate embed" GENERATED_POS)
+    if (GENERATED_POS EQUAL -1)
+        message(FATAL_ERROR "${HEADER} was not generated by gdeflate embed")
+    endif()
+    string(SUBSTRING "${HEADER_SOURCE}" 0 ${GENERATED_POS} HEADER_PROLOG)
+    string(SUBSTRING "${HEADER_SOURCE}" ${GENERATED_POS} -1 HEADER_BODY)
+    file(WRITE ${HEADER} "${HEADER_PROLOG}${CHECKSUM_PREFIX}${GLSL_CHECKSUM}\n${HEADER_BODY}")
+    return()
+endif()
+
+string(REGEX MATCH "${CHECKSUM_PREFIX}([0-9a-f]*)\n" HEADER_CHECKSUM "${HEADER_SOURCE}")
+if (NOT CMAKE_MATCH_1 STREQUAL GLSL_CHECKSUM)
+    message(FATAL_ERROR "${HEADER} is out of date with the GLSL shaders, run compile.sh or compile.bat to regenerate it")
+endif()
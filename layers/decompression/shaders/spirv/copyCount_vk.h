@@ -1,48 +0,0 @@
-/* Copyright (c) 2023-2025 The Khronos Group Inc.
- * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
- * SPDX-License-Identifier: Apache-2.0 or MIT
- *
- * Licensed under either of
- *   Apache License, Version 2.0 (http://www.apache.org/licenses/LICENSE-2.0)
- *   or
- *   MIT license (http://opensource.org/licenses/MIT)
- * at your option.
- *
- * Any contribution submitted by you to Khronos for inclusion in this work shall be dual licensed as above.
- *
- * Author: Ilya Terentiev <iterentiev@nvidia.com>
- * Author: Vikram Kushwaha <vkushwaha@nvidia.com>
- */
-
-	// 1115.2.0
-	 #pragma once
-const uint32_t copyCount[] = {
-	0x07230203,0x00010500,0x0008000b,0x00000024,0x00000000,0x00020011,0x00000001,0x00020011,
-	0x000014e3,0x0006000b,0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,
-	0x000014e4,0x00000001,0x0006000f,0x00000005,0x00000004,0x6e69616d,0x00000000,0x0000000f,
-	0x00060010,0x00000004,0x00000011,0x00000001,0x00000001,0x00000001,0x00040047,0x00000008,
-	0x00000006,0x00000004,0x00030047,0x00000009,0x00000002,0x00050048,0x00000009,0x00000000,
-	0x00000023,0x00000000,0x00030047,0x0000000b,0x000014ec,0x00030047,0x0000000d,0x00000002,
-	0x00050048,0x0000000d,0x00000000,0x00000023,0x00000000,0x00050048,0x0000000d,0x00000001,
-	0x00000023,0x00000008,0x00030047,0x00000016,0x000014ec,0x00040047,0x00000023,0x0000000b,
-	0x00000019,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030027,0x00000006,
-	0x000014e5,0x00040015,0x00000007,0x00000020,0x00000000,0x0003001d,0x00000008,0x00000007,
-	0x0003001e,0x00000009,0x00000008,0x00040020,0x00000006,0x000014e5,0x00000009,0x00040020,
-	0x0000000a,0x00000007,0x00000006,0x00040017,0x0000000c,0x00000007,0x00000002,0x0004001e,
-	0x0000000d,0x0000000c,0x0000000c,0x00040020,0x0000000e,0x00000009,0x0000000d,0x0004003b,
-	0x0000000e,0x0000000f,0x00000009,0x00040015,0x00000010,0x00000020,0x00000001,0x0004002b,
-	0x00000010,0x00000011,0x00000000,0x00040020,0x00000012,0x00000009,0x0000000c,0x0004002b,
-	0x00000010,0x00000017,0x00000001,0x00040020,0x0000001d,0x000014e5,0x00000007,0x00040017,
-	0x00000021,0x00000007,0x00000003,0x0004002b,0x00000007,0x00000022,0x00000001,0x0006002c,
-	0x00000021,0x00000023,0x00000022,0x00000022,0x00000022,0x00050036,0x00000002,0x00000004,
-	0x00000000,0x00000003,0x000200f8,0x00000005,0x0004003b,0x0000000a,0x0000000b,0x00000007,
-	0x0004003b,0x0000000a,0x00000016,0x00000007,0x00050041,0x00000012,0x00000013,0x0000000f,
-	0x00000011,0x0004003d,0x0000000c,0x00000014,0x00000013,0x0004007c,0x00000006,0x00000015,
-	0x00000014,0x0003003e,0x0000000b,0x00000015,0x00050041,0x00000012,0x00000018,0x0000000f,
-	0x00000017,0x0004003d,0x0000000c,0x00000019,0x00000018,0x0004007c,0x00000006,0x0000001a,
-	0x00000019,0x0003003e,0x00000016,0x0000001a,0x0004003d,0x00000006,0x0000001b,0x00000016,
-	0x0004003d,0x00000006,0x0000001c,0x0000000b,0x00060041,0x0000001d,0x0000001e,0x0000001c,
-	0x00000011,0x00000011,0x0006003d,0x00000007,0x0000001f,0x0000001e,0x00000002,0x00000004,
-	0x00060041,0x0000001d,0x00000020,0x0000001b,0x00000011,0x00000011,0x0005003e,0x00000020,
-	0x0000001f,0x00000002,0x00000004,0x000100fd,0x00010038
-};
@@ -28,6 +28,10 @@
 #include <vector>
 #include <atomic>
 #include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
 
 #include <vulkan/vulkan.h>
 #include <vulkan/vk_layer.h>
@@ -41,11 +45,17 @@
 #include "vk_common.h"
 
 #include "shader_object/shader_object_structs.h"
+#include "shader_object/shader_object_statistics.h"
 
 #define kLayerSettingsForceEnable "force_enable"
 #define kLayerSettingsDisablePipelinePreCaching "disable_pipeline_pre_caching"
+#define kLayerSettingsAsyncPipelineCompilation "async_pipeline_compilation"
+#define kLayerSettingsPipelineCachePath "pipeline_cache_path"
+#define kLayerSettingsDrawStateJournal "draw_state_journal"
 
 #define SHADER_OBJECT_BINARY_VERSION 1
+// Bump when DrawStateJournalEntryHeader, the memory layout of FullDrawStateData or the journal ids of shaders change
+#define DRAW_STATE_JOURNAL_VERSION 2
 
 //#define ENABLE_DEBUG_LOG
 //#define DEBUG_LOG_TO_OUTPUT
@@ -181,6 +191,9 @@ namespace shader_object {
 struct LayerSettings {
     bool force_enable{false};
     bool disable_pipeline_pre_caching{false};
+    bool async_pipeline_compilation{false};
+    std::string pipeline_cache_path;
+    std::string draw_state_journal;
 };
 
 struct InstanceData {
@@ -416,6 +429,7 @@ VkResult Shader::Create(DeviceData const& deviceData, VkShaderCreateInfoEXT cons
 
     *ppOutShader = shader;
     shader->stage = createInfo.stage;
+    shader->create_flags = createInfo.flags;
     if (createInfo.flags & VK_SHADER_CREATE_ALLOW_VARYING_SUBGROUP_SIZE_BIT_EXT) {
         shader->flags |= VK_PIPELINE_SHADER_STAGE_CREATE_ALLOW_VARYING_SUBGROUP_SIZE_BIT;
     }
@@ -670,6 +684,132 @@ VkResult Shader::Create(DeviceData const& deviceData, VkShaderCreateInfoEXT cons
     return result;
 }
 
+// Returns the content of a pipeline cache file, or nothing if it is missing or was written for another device
+static std::vector<uint8_t> ReadPipelineCacheFile(std::string const& path, VkPhysicalDeviceProperties const& properties) {
+    std::vector<uint8_t> data;
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return data;
+    }
+    uint8_t buffer[64 * 1024];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + read);
+    }
+    bool const ok = ferror(file) == 0;
+    fclose(file);
+
+    VkPipelineCacheHeaderVersionOne header;
+    if (!ok || data.size() < sizeof(header)) {
+        data.clear();
+        return data;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE || header.vendorID != properties.vendorID ||
+        header.deviceID != properties.deviceID ||
+        memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        data.clear();
+    }
+    return data;
+}
+
+// Writes the file under a temporary name first, so that concurrent processes never read a partial cache
+static bool WritePipelineCacheFile(std::string const& path, std::vector<uint8_t> const& data) {
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+
+    std::string const temp_path = path + "." + std::to_string(std::random_device()()) + ".tmp";
+    FILE* file = fopen(temp_path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool const written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    if (fclose(file) != 0 || !written) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    return true;
+}
+
+// Merges the pipelines stored by earlier runs into the draw time cache of a newly created shader
+static void LoadPipelineCacheFile(DeviceData const& device_data, Shader& shader) {
+    std::vector<uint8_t> const data = ReadPipelineCacheFile(shader.pipeline_cache_file, device_data.properties);
+    if (data.empty()) {
+        return;
+    }
+
+    VkPipelineCacheCreateInfo cache_create_info{VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, nullptr, 0, data.size(), data.data()};
+    VkPipelineCache file_cache = VK_NULL_HANDLE;
+    if (device_data.vtable.CreatePipelineCache(device_data.device, &cache_create_info, nullptr, &file_cache) != VK_SUCCESS) {
+        return;
+    }
+    device_data.vtable.MergePipelineCaches(device_data.device, shader.cache, 1, &file_cache);
+    device_data.vtable.DestroyPipelineCache(device_data.device, file_cache, nullptr);
+}
+
+// Writes the draw time cache of the shader to its file, together with what other processes stored there since it was
+// loaded. Pipelines may be created with the cache meanwhile, so it is only read from. If the file can't be written, the
+// cache stays dirty so that the next store tries again.
+static void StorePipelineCacheFile(DeviceData const& device_data, Shader& shader) {
+    if (!shader.pipeline_cache_dirty.exchange(false)) {
+        return;
+    }
+    auto& vtable = device_data.vtable;
+
+    std::vector<uint8_t> const file_data = ReadPipelineCacheFile(shader.pipeline_cache_file, device_data.properties);
+    VkPipelineCacheCreateInfo cache_create_info{VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, nullptr, 0, file_data.size(),
+                                                file_data.data()};
+    VkPipelineCache merged_cache = VK_NULL_HANDLE;
+    if (vtable.CreatePipelineCache(device_data.device, &cache_create_info, nullptr, &merged_cache) != VK_SUCCESS) {
+        shader.pipeline_cache_dirty = true;
+        return;
+    }
+
+    std::vector<uint8_t> data;
+    size_t data_size = 0;
+    if (vtable.MergePipelineCaches(device_data.device, merged_cache, 1, &shader.cache) == VK_SUCCESS &&
+        vtable.GetPipelineCacheData(device_data.device, merged_cache, &data_size, nullptr) == VK_SUCCESS) {
+        data.resize(data_size);
+        if (vtable.GetPipelineCacheData(device_data.device, merged_cache, &data_size, data.data()) == VK_SUCCESS) {
+            data.resize(data_size);
+        } else {
+            data.clear();
+        }
+    }
+    vtable.DestroyPipelineCache(device_data.device, merged_cache, nullptr);
+
+    if (data.empty() || (data != file_data && !WritePipelineCacheFile(shader.pipeline_cache_file, data))) {
+        shader.pipeline_cache_dirty = true;
+    }
+}
+
+// Called after a draw time pipeline was created with the cache of the shader. Writing the whole cache after every
+// pipeline would make bursts of pipeline creation quadratic, so the file is written at most once per second and when
+// the shader is destroyed. The periodic writes run on a worker thread, to keep file IO off the recording threads.
+static void UpdatePipelineCacheFile(DeviceData const& device_data, Shader& shader) {
+    if (shader.pipeline_cache_file.empty()) {
+        return;
+    }
+    shader.pipeline_cache_dirty = true;
+
+    constexpr int64_t kWriteInterval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)).count();
+    int64_t const now = std::chrono::steady_clock::now().time_since_epoch().count();
+    int64_t last_write_time = shader.pipeline_cache_write_time;
+    if (now - last_write_time < kWriteInterval ||
+        !shader.pipeline_cache_write_time.compare_exchange_strong(last_write_time, now)) {
+        return;
+    }
+
+    Shader* shaders[NUM_SHADERS] = {&shader};
+    device_data.pipeline_compile_queue.Push(shaders, [&device_data, &shader]() { StorePipelineCacheFile(device_data, shader); });
+}
+
 void Shader::Destroy(DeviceData const& device_data, Shader* pShader, VkAllocationCallbacks const& allocator) {
     if (pShader == nullptr) {
         return;
@@ -678,6 +818,22 @@ void Shader::Destroy(DeviceData const& device_data, Shader* pShader, VkAllocatio
     auto  device = device_data.device;
     auto& vtable = device_data.vtable;
 
+    if (device_data.flags & DeviceData::DRAW_STATE_JOURNAL) {
+        auto& journal = device_data.draw_state_journal;
+        std::unique_lock<std::mutex> lock(journal.mutex);
+        Shader* const* found_shader_ptr = journal.shaders.GetOrNullptr(pShader->journal_id);
+        if (found_shader_ptr && *found_shader_ptr == pShader) {
+            journal.shaders.Remove(pShader->journal_id);
+        }
+    }
+    if ((device_data.flags & (DeviceData::ASYNC_PIPELINE_COMPILATION | DeviceData::DRAW_STATE_JOURNAL)) ||
+        !device_data.pipeline_cache_path.empty()) {
+        device_data.pipeline_compile_queue.Wait(pShader);
+    }
+    if (!pShader->pipeline_cache_file.empty()) {
+        StorePipelineCacheFile(device_data, *pShader);
+    }
+
     if (pShader->pristine_cache != VK_NULL_HANDLE) {
         vtable.DestroyPipelineCache(device, pShader->pristine_cache, nullptr);
     }
@@ -696,7 +852,10 @@ void Shader::Destroy(DeviceData const& device_data, Shader* pShader, VkAllocatio
 
     auto& pipelines = pShader->pipelines.GetDataUnsafe();
     for (auto const& pair : pipelines) {
-        vtable.DestroyPipeline(device, pair.value, nullptr);
+        vtable.DestroyPipeline(device, pair.value.pipeline, nullptr);
+        if (pair.value.fast_linked_pipeline != pair.value.pipeline) {
+            vtable.DestroyPipeline(device, pair.value.fast_linked_pipeline, nullptr);
+        }
     }
     pipelines.Clear();
     if (pShader->shader_module != VK_NULL_HANDLE) {
@@ -760,6 +919,19 @@ static uint64_t CalculateSpirvChecksum(void const* spirv_data, size_t spirv_data
     return ChecksumFletcher64(static_cast<uint32_t const*>(spirv_data), spirv_data_size / sizeof(uint32_t));
 }
 
+// Pipeline cache files are named after the cache UUID of the device and the shader, so that devices never share a file
+// and a driver update starts a new one
+static std::string PipelineCacheFileName(DeviceData const& deviceData, Shader const& shader) {
+    char name[2 * VK_UUID_SIZE + 64];
+    int length = snprintf(name, sizeof(name), "shader_object_");
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+        length += snprintf(name + length, sizeof(name) - length, "%02x", deviceData.properties.pipelineCacheUUID[i]);
+    }
+    snprintf(name + length, sizeof(name) - length, "_%x_%016llx.bin", static_cast<uint32_t>(shader.stage),
+             static_cast<unsigned long long>(CalculateSpirvChecksum(shader.spirv_data, shader.spirv_data_size)));
+    return (std::filesystem::path(deviceData.pipeline_cache_path) / name).string();
+}
+
 VkResult ShaderBinary::Create(DeviceData const& deviceData, Shader const& shader, void* out) {
     auto& vtable = deviceData.vtable;
     auto  binary = static_cast<ShaderBinary*>(out);
@@ -938,10 +1110,7 @@ static void SetComputeShaderDebugUtilsTag(DeviceData& data, Shader* shader, cons
     data.vtable.SetDebugUtilsObjectTagEXT(data.device, &tag_info);
 }
 
-static void SetDebugUtilsNameAndTag(CommandBufferData& cmd_data, VkPipeline pipeline) {
-    auto& device_data = *cmd_data.device_data;
-    auto const state  = cmd_data.GetDrawStateData();
-
+static void SetDebugUtilsNameAndTag(DeviceData& device_data, FullDrawStateData* state, VkPipeline pipeline) {
     if (device_data.debug_utils_object_name_map.NumEntries() > 0) {
         bool first_shader = true;
         bool same_name = true;
@@ -1046,10 +1215,169 @@ static void SetDebugUtilsNameAndTag(CommandBufferData& cmd_data, VkPipeline pipe
     }
 }
 
-static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData& cmd_data) {
-    auto& device_data = *cmd_data.device_data;
-    auto const state  = cmd_data.GetDrawStateData();
+enum PipelineCompileMode {
+    // Link the partial pipelines that match the draw state and compile the rest
+    LINK_AVAILABLE_LIBRARIES,
+    // Only link partial pipelines, fails unless they contain every shader
+    FAST_LINK,
+    // Compile all shaders together so that the driver can optimize across stages
+    OPTIMIZED,
+    // Same as OPTIMIZED, but fails unless the pipeline cache already holds the pipeline
+    CACHE_ONLY,
+};
 
+// Interface libraries are keyed by the bytes of the state they are created with, none of the state structures has padding
+template <typename T>
+static void AppendToLibraryKey(std::string& key, T const* values, uint32_t count = 1) {
+    if (count > 0) {
+        key.append(reinterpret_cast<char const*>(values), sizeof(T) * count);
+    }
+}
+
+static std::string GetVertexInputLibraryKey(DeviceData const& device_data, VkGraphicsPipelineCreateInfo const& create_info) {
+    std::string key;
+    auto const& vertex_input = *create_info.pVertexInputState;
+    if (!device_data.HasDynamicState(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        AppendToLibraryKey(key, &vertex_input.vertexBindingDescriptionCount);
+        AppendToLibraryKey(key, vertex_input.pVertexBindingDescriptions, vertex_input.vertexBindingDescriptionCount);
+        AppendToLibraryKey(key, &vertex_input.vertexAttributeDescriptionCount);
+        AppendToLibraryKey(key, vertex_input.pVertexAttributeDescriptions, vertex_input.vertexAttributeDescriptionCount);
+    }
+    AppendToLibraryKey(key, &create_info.pInputAssemblyState->topology);
+    AppendToLibraryKey(key, &create_info.pInputAssemblyState->primitiveRestartEnable);
+    return key;
+}
+
+static std::string GetFragmentOutputLibraryKey(VkGraphicsPipelineCreateInfo const& create_info,
+                                               VkPipelineRenderingCreateInfo const& rendering_info) {
+    std::string key;
+    auto const& multisample_state = *create_info.pMultisampleState;
+    AppendToLibraryKey(key, &multisample_state.rasterizationSamples);
+    AppendToLibraryKey(key, multisample_state.pSampleMask, (multisample_state.rasterizationSamples + 31) / 32);
+    AppendToLibraryKey(key, &multisample_state.alphaToCoverageEnable);
+    AppendToLibraryKey(key, &multisample_state.alphaToOneEnable);
+    for (auto next = reinterpret_cast<VkBaseInStructure const*>(multisample_state.pNext); next != nullptr; next = next->pNext) {
+        AppendToLibraryKey(key, &next->sType);
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: {
+                auto sample_locations = reinterpret_cast<VkPipelineSampleLocationsStateCreateInfoEXT const*>(next);
+                AppendToLibraryKey(key, &sample_locations->sampleLocationsEnable);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: {
+                auto coverage_modulation = reinterpret_cast<VkPipelineCoverageModulationStateCreateInfoNV const*>(next);
+                AppendToLibraryKey(key, &coverage_modulation->coverageModulationMode);
+                AppendToLibraryKey(key, &coverage_modulation->coverageModulationTableEnable);
+                AppendToLibraryKey(key, &coverage_modulation->coverageModulationTableCount);
+                AppendToLibraryKey(key, coverage_modulation->pCoverageModulationTable,
+                                   coverage_modulation->coverageModulationTableCount);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV: {
+                auto coverage_reduction = reinterpret_cast<VkPipelineCoverageReductionStateCreateInfoNV const*>(next);
+                AppendToLibraryKey(key, &coverage_reduction->coverageReductionMode);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: {
+                auto coverage_to_color = reinterpret_cast<VkPipelineCoverageToColorStateCreateInfoNV const*>(next);
+                AppendToLibraryKey(key, &coverage_to_color->coverageToColorEnable);
+                AppendToLibraryKey(key, &coverage_to_color->coverageToColorLocation);
+                break;
+            }
+            default:
+                ASSERT(!"Unknown multisample state structure");
+                break;
+        }
+    }
+
+    auto const& color_blend_state = *create_info.pColorBlendState;
+    AppendToLibraryKey(key, &color_blend_state.logicOpEnable);
+    AppendToLibraryKey(key, &color_blend_state.logicOp);
+    AppendToLibraryKey(key, &color_blend_state.attachmentCount);
+    AppendToLibraryKey(key, color_blend_state.pAttachments, color_blend_state.attachmentCount);
+
+    AppendToLibraryKey(key, &rendering_info.colorAttachmentCount);
+    AppendToLibraryKey(key, rendering_info.pColorAttachmentFormats, rendering_info.colorAttachmentCount);
+    AppendToLibraryKey(key, &rendering_info.depthAttachmentFormat);
+    AppendToLibraryKey(key, &rendering_info.stencilAttachmentFormat);
+    return key;
+}
+
+// Returns the device-wide vertex input or fragment output interface library for the state in create_info, creating it on
+// first use. These libraries contain no shaders, so they are cheap to create and any draw state sharing them can link them.
+static VkPipeline GetInterfaceLibrary(DeviceData& device_data, VkGraphicsPipelineCreateInfo const& create_info,
+                                      VkPipelineRenderingCreateInfo const& rendering_info,
+                                      VkGraphicsPipelineLibraryFlagBitsEXT library_flag) {
+    bool const vertex_input = library_flag == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+    auto& libraries = vertex_input ? device_data.vertex_input_libraries : device_data.fragment_output_libraries;
+    std::string const key =
+        vertex_input ? GetVertexInputLibraryKey(device_data, create_info) : GetFragmentOutputLibraryKey(create_info, rendering_info);
+    {
+        std::shared_lock<std::shared_mutex> lock;
+        VkPipeline const* found_library_ptr = libraries.GetDataForReading(lock).GetOrNullptr(key);
+        if (found_library_ptr) {
+            return *found_library_ptr;
+        }
+    }
+
+    VkPipelineRenderingCreateInfo library_rendering_info = rendering_info;
+    library_rendering_info.pNext = nullptr;
+    VkGraphicsPipelineLibraryCreateInfoEXT library_info{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+                                                        vertex_input ? nullptr : &library_rendering_info, library_flag};
+
+    VkGraphicsPipelineCreateInfo library_create_info{};
+    library_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    library_create_info.pNext = &library_info;
+    library_create_info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    if (vertex_input) {
+        library_create_info.pVertexInputState = create_info.pVertexInputState;
+        library_create_info.pInputAssemblyState = create_info.pInputAssemblyState;
+    } else {
+        library_create_info.pMultisampleState = create_info.pMultisampleState;
+        library_create_info.pColorBlendState = create_info.pColorBlendState;
+    }
+    library_create_info.pDynamicState = create_info.pDynamicState;
+    library_create_info.basePipelineIndex = -1;
+
+    VkPipeline library = VK_NULL_HANDLE;
+    VkResult result =
+        device_data.vtable.CreateGraphicsPipelines(device_data.device, VK_NULL_HANDLE, 1, &library_create_info, nullptr, &library);
+    if (result != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
+
+    std::unique_lock<std::shared_mutex> lock;
+    auto& library_map = libraries.GetDataForWriting(lock);
+    // Another thread may have created a library for the same state in the meantime
+    VkPipeline const* found_library_ptr = library_map.GetOrNullptr(key);
+    if (found_library_ptr) {
+        device_data.vtable.DestroyPipeline(device_data.device, library, nullptr);
+        return *found_library_ptr;
+    }
+    library_map.Add(key, library);
+    return library;
+}
+
+// With VK_EXT_dynamic_rendering_unused_attachments, pipelines are created with a format for every color attachment. Unused
+// attachments get the format of the attachment before them. Done before the state is used as a key, so that the pipeline
+// map stores the formats the pipeline was created with.
+static void SetUnusedColorAttachmentFormats(DeviceData const& device_data, FullDrawStateData* state) {
+    if ((device_data.enabled_extensions & DYNAMIC_RENDERING_UNUSED_ATTACHMENTS) == 0) {
+        return;
+    }
+    VkFormat lastFormat = VK_FORMAT_R8G8B8A8_UNORM;
+    for (uint32_t i = 0; i < device_data.properties.limits.maxColorAttachments; ++i) {
+        VkFormat format = state->GetColorAttachmentFormatPtr()[i];
+        if (format == VK_FORMAT_UNDEFINED) {
+            state->SetColorAttachmentFormat(i, lastFormat);
+        } else {
+            lastFormat = format;
+        }
+    }
+}
+
+static VkPipeline CreateGraphicsPipelineForDrawState(DeviceData& device_data, FullDrawStateData* state,
+                                                     VkPipelineLayout last_seen_pipeline_layout, PipelineCompileMode mode) {
     // gather shaders
     uint32_t num_stages = 0;
     VkPipelineShaderStageCreateInfo stages[NUM_SHADERS] = {};
@@ -1104,16 +1432,15 @@ static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData&
     if (pipeline_create_flag2_create_info.flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_HEAP_BIT_EXT) {
         pipeline_layout = VK_NULL_HANDLE;
     } else if (pipeline_layout == VK_NULL_HANDLE) {
-        pipeline_layout =
-            cmd_data.last_seen_pipeline_layout_ ? cmd_data.last_seen_pipeline_layout_ : cmd_data.device_data->dummy_pipeline_layout;
+        pipeline_layout = last_seen_pipeline_layout ? last_seen_pipeline_layout : device_data.dummy_pipeline_layout;
     }
 
     const uint32_t num_color_attachments = (device_data.enabled_extensions & DYNAMIC_RENDERING_UNUSED_ATTACHMENTS) ? device_data.properties.limits.maxColorAttachments : state->GetNumColorAttachments();
 
     VkPipelineViewportStateCreateInfo viewport_state{};
     viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewport_state.viewportCount = cmd_data.device_data->HasDynamicState(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) ? 0u : state->GetNumViewports();
-    viewport_state.scissorCount = cmd_data.device_data->HasDynamicState(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT) ? 0u : state->GetNumScissors();
+    viewport_state.viewportCount = device_data.HasDynamicState(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) ? 0u : state->GetNumViewports();
+    viewport_state.scissorCount = device_data.HasDynamicState(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT) ? 0u : state->GetNumScissors();
     VkPipelineViewportDepthClipControlCreateInfoEXT depth_clip_control_state{
         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT,
         nullptr,
@@ -1316,7 +1643,7 @@ static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData&
 
     VkGraphicsPipelineCreateInfo create_info{};
     create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    // create_info.flags;
+    create_info.flags = (mode == CACHE_ONLY) ? VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT : 0;
     create_info.stageCount = num_stages;
     create_info.pStages = stages;
     create_info.pVertexInputState = &vertex_input;
@@ -1346,18 +1673,6 @@ static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData&
         append_to_chain(&pipeline_create_flag2_create_info);
     }
 
-    if (device_data.enabled_extensions & DYNAMIC_RENDERING_UNUSED_ATTACHMENTS) {
-        VkFormat lastFormat = VK_FORMAT_R8G8B8A8_UNORM;
-        for (uint32_t i = 0; i < num_color_attachments; ++i) {
-            VkFormat format = state->GetColorAttachmentFormatPtr()[i];
-            if (format == VK_FORMAT_UNDEFINED) {
-                state->SetColorAttachmentFormat(i, lastFormat);
-            } else {
-                lastFormat = format;
-            }
-        }
-    }
-
     VkPipelineRenderingCreateInfo rendering_create_info{
         VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
         nullptr,
@@ -1382,8 +1697,8 @@ static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData&
     VkPipelineLibraryCreateInfoKHR pl_create_info{VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR};
 
     // If we have graphics pipeline support, we might be able to use some precompiled pipelines
-    VkPipeline libraries[2]{};
-    if (device_data.enabled_extensions & GRAPHICS_PIPELINE_LIBRARY) {
+    VkPipeline libraries[4]{};
+    if ((device_data.enabled_extensions & GRAPHICS_PIPELINE_LIBRARY) && (mode == LINK_AVAILABLE_LIBRARIES || mode == FAST_LINK)) {
         // describe full pipeline compilation, we'll remove flags for libraries that we have access to and can use
         gpl_create_info.flags = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
                                 VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
@@ -1436,24 +1751,52 @@ static VkPipeline CreateGraphicsPipelineForCommandBufferState(CommandBufferData&
                                           VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)) == 0) {
                 create_info.pStages = nullptr;
                 create_info.stageCount = 0;
+
+                // With every shader precompiled, linking the interface libraries too turns the pipeline creation into a
+                // link. Descriptor heap pipelines would need libraries with the same flag, so they are left out.
+                if ((pipeline_create_flag2_create_info.flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_HEAP_BIT_EXT) == 0) {
+                    VkPipeline vertex_input_library = GetInterfaceLibrary(
+                        device_data, create_info, rendering_create_info, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+                    VkPipeline fragment_output_library =
+                        GetInterfaceLibrary(device_data, create_info, rendering_create_info,
+                                            VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+                    if (vertex_input_library != VK_NULL_HANDLE && fragment_output_library != VK_NULL_HANDLE) {
+                        libraries[pl_create_info.libraryCount++] = vertex_input_library;
+                        libraries[pl_create_info.libraryCount++] = fragment_output_library;
+                        ASSERT(pl_create_info.libraryCount <= GetArrayLength(libraries));
+                        gpl_create_info.flags &= ~(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+                                                   VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+                    }
+                }
             }
 
-            // add to pnext chain
-            append_to_chain(&gpl_create_info);
+            // add to pnext chain, a pipeline made only of libraries has no parts of its own to describe
+            if (gpl_create_info.flags != 0) {
+                append_to_chain(&gpl_create_info);
+            }
             append_to_chain(&pl_create_info);
         }
     }
 
+    // Without partial pipelines for every shader, some shaders would still need to be compiled
+    if (mode == FAST_LINK && (pl_create_info.libraryCount == 0 ||
+                              (gpl_create_info.flags & (VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+                                                        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)) != 0)) {
+        return VK_NULL_HANDLE;
+    }
+
     ASSERT((pipeline_create_flag2_create_info.flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_HEAP_BIT_EXT) ||
            create_info.layout != VK_NULL_HANDLE);
 
-    VkPipeline pipeline;
-    VkResult result = cmd_data.device_data->vtable.CreateGraphicsPipelines(
-        cmd_data.device_data->device, vertex_or_mesh_shader->cache, 1, &create_info, nullptr, &pipeline);
-    ASSERT(result == VK_SUCCESS);
-    UNUSED(result);
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = device_data.vtable.CreateGraphicsPipelines(
+        device_data.device, vertex_or_mesh_shader->cache, 1, &create_info, nullptr, &pipeline);
+    ASSERT(result == VK_SUCCESS || (mode == CACHE_ONLY && result == VK_PIPELINE_COMPILE_REQUIRED));
+    if (result != VK_SUCCESS) {
+        return VK_NULL_HANDLE;
+    }
 
-    SetDebugUtilsNameAndTag(cmd_data, pipeline);
+    SetDebugUtilsNameAndTag(device_data, state, pipeline);
 
     return pipeline;
 }
@@ -2013,6 +2356,356 @@ static VkBaseOutStructure* FindStructureInChain(VkBaseOutStructure* pNext, VkStr
     return nullptr;
 }
 
+void PipelineCompileQueue::Start(uint32_t num_threads) {
+    for (uint32_t i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&PipelineCompileQueue::Run, this);
+    }
+}
+
+void PipelineCompileQueue::Stop() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stopping_ = true;
+        queue_.clear();
+    }
+    job_available_.notify_all();
+
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void PipelineCompileQueue::Push(Shader* const shaders[NUM_SHADERS], Job&& job) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_.emplace_back();
+        std::copy(shaders, shaders + NUM_SHADERS, queue_.back().shaders);
+        queue_.back().job = std::move(job);
+    }
+    job_available_.notify_one();
+}
+
+void PipelineCompileQueue::Wait(Shader const* shader) {
+    auto const uses_shader = [shader](Entry const& entry) { return entry.Uses(shader); };
+
+    // A running job may queue another one for the shader, such as a store of its pipeline cache file, so the queue is
+    // cleared again whenever a job finishes
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [&] {
+        queue_.erase(std::remove_if(queue_.begin(), queue_.end(), uses_shader), queue_.end());
+        return std::none_of(running_.begin(), running_.end(), [&](Entry const* entry) { return uses_shader(*entry); });
+    });
+}
+
+bool PipelineCompileQueue::Entry::Uses(Shader const* shader) const {
+    return std::find(shaders, shaders + NUM_SHADERS, shader) != shaders + NUM_SHADERS;
+}
+
+void PipelineCompileQueue::Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_available_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+
+        Entry entry = std::move(queue_.front());
+        queue_.pop_front();
+        running_.push_back(&entry);
+
+        lock.unlock();
+        entry.job();
+        lock.lock();
+
+        running_.erase(std::find(running_.begin(), running_.end(), &entry));
+        job_finished_.notify_all();
+    }
+}
+
+// Creates the pipeline for the draw state of a command buffer. With asynchronous pipeline compilation, a pipeline that is
+// quick to create is preferred and the optimized pipeline is compiled in the background.
+static DrawStatePipeline CreateDrawStatePipeline(CommandBufferData& data, Shader const* vertex_or_mesh_shader) {
+    auto& device_data = *data.device_data;
+    auto const state  = data.GetDrawStateData();
+
+    // Background compilation can't use the application's pipeline layout, since it may be destroyed at any time
+    bool const async = (device_data.flags & DeviceData::ASYNC_PIPELINE_COMPILATION) &&
+                       (vertex_or_mesh_shader->pipeline_layout != VK_NULL_HANDLE || data.last_seen_pipeline_layout_ == VK_NULL_HANDLE);
+
+    DrawStatePipeline draw_state_pipeline;
+    if (async && (device_data.flags & DeviceData::HAS_PIPELINE_CREATION_CACHE_CONTROL)) {
+        draw_state_pipeline.pipeline = CreateGraphicsPipelineForDrawState(device_data, state, data.last_seen_pipeline_layout_, CACHE_ONLY);
+    }
+    if (async && draw_state_pipeline.pipeline == VK_NULL_HANDLE) {
+        draw_state_pipeline.fast_linked_pipeline =
+            CreateGraphicsPipelineForDrawState(device_data, state, data.last_seen_pipeline_layout_, FAST_LINK);
+        draw_state_pipeline.pipeline   = draw_state_pipeline.fast_linked_pipeline;
+        draw_state_pipeline.optimizing = draw_state_pipeline.fast_linked_pipeline != VK_NULL_HANDLE;
+    }
+    if (draw_state_pipeline.pipeline == VK_NULL_HANDLE) {
+        draw_state_pipeline.pipeline =
+            CreateGraphicsPipelineForDrawState(device_data, state, data.last_seen_pipeline_layout_, LINK_AVAILABLE_LIBRARIES);
+    }
+    return draw_state_pipeline;
+}
+
+// Runs on a worker thread, replaces the fast-linked pipeline of the draw state with an optimized one
+static void CompileOptimizedPipeline(DeviceData& device_data, Shader* vertex_or_mesh_shader, FullDrawStateData::Key const& key) {
+    VkPipeline pipeline = CreateGraphicsPipelineForDrawState(device_data, key.GetData(), VK_NULL_HANDLE, OPTIMIZED);
+
+    std::unique_lock<std::shared_mutex> lock;
+    auto& pipelines = vertex_or_mesh_shader->pipelines.GetDataForWriting(lock);
+    auto iter = pipelines.Find(key);
+    ASSERT(iter != pipelines.end());
+    auto& draw_state_pipeline = iter.GetValue();
+    if (pipeline != VK_NULL_HANDLE) {
+        draw_state_pipeline.pipeline = pipeline;
+    }
+    draw_state_pipeline.optimizing = false;
+    lock.unlock();
+
+    if (pipeline != VK_NULL_HANDLE) {
+        device_data.statistics.optimized_pipelines.fetch_add(1, std::memory_order_relaxed);
+        UpdatePipelineCacheFile(device_data, *vertex_or_mesh_shader);
+    }
+}
+
+// Returns the pipeline of the draw state, waiting if another thread is creating it. If no thread is, the draw state is
+// reserved and an empty pipeline is returned, the caller then creates the pipeline without blocking other draw states.
+static DrawStatePipeline FindOrReserveDrawStatePipeline(Shader& shader, FullDrawStateData::Key const& key) {
+    DrawStatePipeline const* found_pipeline_ptr = nullptr;
+    auto const is_created = [&](HashMap<FullDrawStateData::Key, DrawStatePipeline, false> const& pipelines) {
+        found_pipeline_ptr = pipelines.GetOrNullptr(key);
+        return found_pipeline_ptr == nullptr || found_pipeline_ptr->pipeline != VK_NULL_HANDLE;
+    };
+
+    {
+        std::shared_lock<std::shared_mutex> lock;
+        auto const& pipelines = shader.pipelines.GetDataForReading(lock);
+        shader.pipeline_created.wait(lock, [&] { return is_created(pipelines); });
+        if (found_pipeline_ptr) {
+            return *found_pipeline_ptr;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock;
+    auto& pipelines = shader.pipelines.GetDataForWriting(lock);
+    // Another thread may have reserved this state between the read lock above and the write lock
+    shader.pipeline_created.wait(lock, [&] { return is_created(pipelines); });
+    if (found_pipeline_ptr) {
+        return *found_pipeline_ptr;
+    }
+    pipelines.Add(key, DrawStatePipeline{});
+    return DrawStatePipeline{};
+}
+
+// Draw state journal files are a sequence of entries, each a header followed by the memory of the draw state. Versions
+// keep magic, version and state_size at the front, so that entries written by other versions can be skipped.
+struct DrawStateJournalEntryHeader {
+    static constexpr uint32_t kMagic        = 0x4A534453; // "SDSJ"
+    static constexpr uint32_t kMaxStateSize = 16u << 20;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t state_size;
+    uint32_t reserved;
+    uint8_t  pipeline_cache_uuid[VK_UUID_SIZE];
+    uint64_t shader_ids[NUM_SHADERS];
+};
+static_assert(sizeof(DrawStateJournalEntryHeader) == 4 * sizeof(uint32_t) + VK_UUID_SIZE + NUM_SHADERS * sizeof(uint64_t),
+              "DrawStateJournalEntryHeader is written to disk and must not have padding");
+
+// Loads the entries recorded on devices with the same pipeline cache UUID and opens the journal to append new ones to
+static void OpenDrawStateJournal(DeviceData& device_data, std::string const& path) {
+    auto& journal = device_data.draw_state_journal;
+    if (FILE* file = fopen(path.c_str(), "rb")) {
+        DrawStateJournalEntryHeader header;
+        // A process that exited while appending may have left a partial entry at the end
+        while (fread(&header, sizeof(header), 1, file) == 1 && header.magic == DrawStateJournalEntryHeader::kMagic &&
+               header.state_size <= DrawStateJournalEntryHeader::kMaxStateSize) {
+            DrawStateJournal::Entry entry{};
+            entry.state.resize(header.state_size);
+            if (fread(entry.state.data(), 1, entry.state.size(), file) != entry.state.size()) {
+                break;
+            }
+            if (header.version == DRAW_STATE_JOURNAL_VERSION &&
+                memcmp(header.pipeline_cache_uuid, device_data.properties.pipelineCacheUUID, VK_UUID_SIZE) == 0) {
+                memcpy(entry.shader_ids, header.shader_ids, sizeof(entry.shader_ids));
+                journal.entries.push_back(std::move(entry));
+            }
+        }
+        fclose(file);
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+    journal.file = fopen(path.c_str(), "ab");
+}
+
+// Runs on a worker thread, appends the draw state to the journal unless an entry with the same shaders and state was
+// loaded or recorded before. Journal memory has no pointers and zeroed padding, so equal states have equal bytes.
+static void AppendDrawStateToJournal(DeviceData& device_data, DrawStateJournal::Entry&& entry) {
+    auto& journal = device_data.draw_state_journal;
+    {
+        // Checked and added under the lock, workers may append the same draw state recorded by several threads
+        std::unique_lock<std::mutex> lock(journal.mutex);
+        for (auto const& journal_entry : journal.entries) {
+            if (memcmp(journal_entry.shader_ids, entry.shader_ids, sizeof(entry.shader_ids)) == 0 &&
+                journal_entry.state == entry.state) {
+                return;
+            }
+        }
+        journal.entries.push_back(entry);
+    }
+
+    if (journal.file != nullptr) {
+        DrawStateJournalEntryHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic      = DrawStateJournalEntryHeader::kMagic;
+        header.version    = DRAW_STATE_JOURNAL_VERSION;
+        header.state_size = static_cast<uint32_t>(entry.state.size());
+        memcpy(header.pipeline_cache_uuid, device_data.properties.pipelineCacheUUID, VK_UUID_SIZE);
+        memcpy(header.shader_ids, entry.shader_ids, sizeof(entry.shader_ids));
+
+        // Written with one call, which stdio does not interleave with the writes of other workers. Flushed right away,
+        // applications often exit without destroying the device.
+        auto& data = entry.state;
+        data.insert(data.begin(), reinterpret_cast<uint8_t const*>(&header), reinterpret_cast<uint8_t const*>(&header + 1));
+        fwrite(data.data(), 1, data.size(), journal.file);
+        fflush(journal.file);
+    }
+}
+
+// Queues the draw state to be appended to the journal, so that the recording thread neither compares it with the
+// entries nor writes the file. The job keeps the journal ids instead of the shaders, destroying the shaders does not
+// discard it.
+static void RecordDrawStateInJournal(DeviceData& device_data, FullDrawStateData const* state) {
+    DrawStateJournal::Entry entry{};
+    for (uint32_t shader_type = 0; shader_type < NUM_SHADERS; ++shader_type) {
+        Shader* shader = state->GetComparableShader(shader_type).GetShaderPtr();
+        entry.shader_ids[shader_type] = shader ? shader->journal_id : 0;
+    }
+    entry.state.resize(state->GetMemorySize());
+    state->CopyToJournalMemory(entry.state.data());
+    entry.replayed = true;
+
+    Shader* const no_shaders[NUM_SHADERS]{};
+    device_data.pipeline_compile_queue.Push(no_shaders, [&device_data, entry = std::move(entry)]() mutable {
+        AppendDrawStateToJournal(device_data, std::move(entry));
+    });
+}
+
+// Runs on a worker thread, compiles the pipeline of a journal entry. The pipeline is dropped if a draw created one for
+// the same state in the meantime.
+static void ReplayDrawStateJournalEntry(DeviceData& device_data, Shader* const shaders[NUM_SHADERS], std::vector<uint8_t> const& memory) {
+    FullDrawStateData* state = FullDrawStateData::CreateFromMemory(
+        memory.data(), memory.size(), device_data.properties, device_data.enabled_extensions & DYNAMIC_RENDERING_UNUSED_ATTACHMENTS, shaders);
+    if (state == nullptr) {
+        return;
+    }
+
+    Shader* vertex_or_mesh_shader = shaders[VERTEX_SHADER] ? shaders[VERTEX_SHADER] : shaders[MESH_SHADER];
+    SetUnusedColorAttachmentFormats(device_data, state);
+    auto key = state->GetKey();
+    bool created = false;
+    {
+        std::shared_lock<std::shared_mutex> lock;
+        created = vertex_or_mesh_shader->pipelines.GetDataForReading(lock).GetOrNullptr(key) != nullptr;
+    }
+
+    VkPipeline pipeline = created ? VK_NULL_HANDLE : CreateGraphicsPipelineForDrawState(device_data, state, VK_NULL_HANDLE, OPTIMIZED);
+    if (pipeline != VK_NULL_HANDLE) {
+        {
+            std::unique_lock<std::shared_mutex> lock;
+            auto& pipelines = vertex_or_mesh_shader->pipelines.GetDataForWriting(lock);
+            created = pipelines.GetOrNullptr(key) != nullptr;
+            if (!created) {
+                DrawStatePipeline draw_state_pipeline;
+                draw_state_pipeline.pipeline = pipeline;
+                pipelines.Add(key, draw_state_pipeline);
+            }
+        }
+
+        if (created) {
+            device_data.vtable.DestroyPipeline(device_data.device, pipeline, nullptr);
+        } else {
+            device_data.statistics.precompiled_pipelines.fetch_add(1, std::memory_order_relaxed);
+            UpdatePipelineCacheFile(device_data, *vertex_or_mesh_shader);
+        }
+    }
+
+    FullDrawStateData::Destroy(state);
+}
+
+// Shaders built from the same SPIR-V with other specialization constants or create flags compile to other pipelines, so
+// they are part of the journal id along with the SPIR-V and the stage
+static uint64_t CalculateJournalId(Shader const& shader) {
+    uint64_t const spirv_checksum = CalculateSpirvChecksum(shader.spirv_data, shader.spirv_data_size);
+    std::vector<uint32_t> words = {static_cast<uint32_t>(spirv_checksum), static_cast<uint32_t>(spirv_checksum >> 32),
+                                   static_cast<uint32_t>(shader.stage), static_cast<uint32_t>(shader.create_flags)};
+    if (shader.specialization_info_ptr != nullptr) {
+        VkSpecializationInfo const& info = *shader.specialization_info_ptr;
+        words.push_back(info.mapEntryCount);
+        for (uint32_t i = 0; i < info.mapEntryCount; ++i) {
+            words.push_back(info.pMapEntries[i].constantID);
+            words.push_back(info.pMapEntries[i].offset);
+            words.push_back(static_cast<uint32_t>(info.pMapEntries[i].size));
+        }
+        words.push_back(static_cast<uint32_t>(info.dataSize));
+        size_t const data_offset = words.size();
+        words.resize(data_offset + (info.dataSize + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+        memcpy(words.data() + data_offset, info.pData, info.dataSize);
+    }
+    return ChecksumFletcher64(words.data(), words.size());
+}
+
+// Adds newly created shaders to the draw state journal, and queues the entries whose shaders are now all alive
+static void ReplayDrawStateJournal(DeviceData& device_data, uint32_t shader_count, VkShaderEXT const* pShaders) {
+    auto& journal = device_data.draw_state_journal;
+    std::unique_lock<std::mutex> lock(journal.mutex);
+    for (uint32_t i = 0; i < shader_count; ++i) {
+        auto shader = *reinterpret_cast<Shader* const*>(&pShaders[i]);
+        if ((shader->stage & (VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT)) == 0) {
+            continue;
+        }
+        shader->journal_id = CalculateJournalId(*shader);
+        journal.shaders.Add(shader->journal_id, shader);
+    }
+
+    for (auto& entry : journal.entries) {
+        if (entry.replayed) {
+            continue;
+        }
+
+        Shader* shaders[NUM_SHADERS]{};
+        bool all_alive = true;
+        for (uint32_t shader_type = 0; shader_type < NUM_SHADERS && all_alive; ++shader_type) {
+            if (entry.shader_ids[shader_type] != 0) {
+                Shader* const* found_shader_ptr = journal.shaders.GetOrNullptr(entry.shader_ids[shader_type]);
+                all_alive = found_shader_ptr != nullptr;
+                shaders[shader_type] = all_alive ? *found_shader_ptr : nullptr;
+            }
+        }
+        if (!all_alive) {
+            continue;
+        }
+        entry.replayed = true;
+
+        // Without a pipeline layout of its own, the pipeline would need the one the application binds at draw time
+        Shader* vertex_or_mesh_shader = shaders[VERTEX_SHADER] ? shaders[VERTEX_SHADER] : shaders[MESH_SHADER];
+        if (vertex_or_mesh_shader == nullptr ||
+            (vertex_or_mesh_shader->pipeline_layout == VK_NULL_HANDLE && !vertex_or_mesh_shader->use_descriptor_heap)) {
+            continue;
+        }
+
+        // Queued under the journal lock, so that none of the shaders is destroyed before the queue knows the job uses it
+        device_data.pipeline_compile_queue.Push(shaders, [&device_data, shaders, memory = entry.state]() {
+            ReplayDrawStateJournalEntry(device_data, shaders, memory);
+        });
+    }
+}
+
 void UpdateDrawState(CommandBufferData& data, VkCommandBuffer commandBuffer) {
     if (!data.graphics_bind_point_belongs_to_layer) {
         return;
@@ -2029,36 +2722,52 @@ void UpdateDrawState(CommandBufferData& data, VkCommandBuffer commandBuffer) {
     }
     ASSERT(vertex_or_mesh_shader != nullptr);
 
-    auto state_data_key     = state_data->GetKey();
-    VkPipeline pipeline     = VK_NULL_HANDLE;
-    uint32_t pipeline_count = 0;
-    {
-        std::shared_lock<std::shared_mutex> lock;
-        auto const& pipelines   = vertex_or_mesh_shader->pipelines.GetDataForReading(lock);
-        auto found_pipeline_ptr = pipelines.GetOrNullptr(state_data_key);
-        if (found_pipeline_ptr) {
-            pipeline = *found_pipeline_ptr;
+    SetUnusedColorAttachmentFormats(*data.device_data, state_data);
+    auto state_data_key = state_data->GetKey();
+    data.device_data->statistics.draw_state_lookups.fetch_add(1, std::memory_order_relaxed);
+    DrawStatePipeline draw_state_pipeline = FindOrReserveDrawStatePipeline(*vertex_or_mesh_shader, state_data_key);
+    if (draw_state_pipeline.pipeline == VK_NULL_HANDLE) {
+        draw_state_pipeline = CreateDrawStatePipeline(data, vertex_or_mesh_shader);
+        if (draw_state_pipeline.pipeline != VK_NULL_HANDLE) {
+            data.device_data->statistics.draw_time_pipelines.fetch_add(1, std::memory_order_relaxed);
         }
-        pipeline_count = pipelines.NumEntries();
-    }
-    if (pipeline == VK_NULL_HANDLE) {
-        std::unique_lock<std::shared_mutex> lock;
-        auto& pipelines = vertex_or_mesh_shader->pipelines.GetDataForWriting(lock);
-        // Ensure that a pipeline for this state wasn't created in another thread between the read lock above and the write lock
-        if (pipelines.NumEntries() > pipeline_count) {
-            auto iter = pipelines.Find(state_data_key);
-            if (iter != pipelines.end()) {
-                pipeline = iter.GetValue();
+
+        {
+            std::unique_lock<std::shared_mutex> lock;
+            auto& pipelines = vertex_or_mesh_shader->pipelines.GetDataForWriting(lock);
+            if (draw_state_pipeline.pipeline != VK_NULL_HANDLE) {
+                pipelines.Find(state_data_key).GetValue() = draw_state_pipeline;
+            } else {
+                // Let the next draw with this state try again
+                pipelines.Remove(state_data_key);
             }
         }
-        if (pipeline == VK_NULL_HANDLE) {
-            pipeline = CreateGraphicsPipelineForCommandBufferState(data);
-            pipelines.Add(state_data_key, pipeline);
+        vertex_or_mesh_shader->pipeline_created.notify_all();
+
+        if (draw_state_pipeline.optimizing) {
+            Shader* shaders[NUM_SHADERS];
+            for (uint32_t shader_type = 0; shader_type < NUM_SHADERS; ++shader_type) {
+                shaders[shader_type] = state_data->GetComparableShader(shader_type).GetShaderPtr();
+            }
+
+            // The job owns a copy of the draw state, the key it finds the pipeline with once compiled
+            auto device_data = data.device_data;
+            device_data->pipeline_compile_queue.Push(shaders, [device_data, vertex_or_mesh_shader, key = state_data_key]() {
+                CompileOptimizedPipeline(*device_data, vertex_or_mesh_shader, key);
+            });
+        } else if (draw_state_pipeline.pipeline != VK_NULL_HANDLE) {
+            UpdatePipelineCacheFile(*data.device_data, *vertex_or_mesh_shader);
+        }
+
+        if (draw_state_pipeline.pipeline != VK_NULL_HANDLE && (data.device_data->flags & DeviceData::DRAW_STATE_JOURNAL)) {
+            RecordDrawStateInJournal(*data.device_data, state_data);
         }
     }
 
-    data.device_data->vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-    state_data->is_dirty_ = false;
+    data.device_data->vtable.CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, draw_state_pipeline.pipeline);
+
+    // Keep looking the pipeline up on later draws until the optimized pipeline replaces the fast-linked one
+    state_data->is_dirty_ = draw_state_pipeline.optimizing;
 }
 
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char* pName);
@@ -2075,7 +2784,9 @@ void InitLayerSettings(const VkInstanceCreateInfo* pCreateInfo, const VkAllocati
     VkuLayerSettingSet layer_setting_set = VK_NULL_HANDLE;
     vkuCreateLayerSettingSet(shader_object::kGlobalLayer.layerName, create_info, pAllocator, nullptr, &layer_setting_set);
 
-    static const char* setting_names[] = {kLayerSettingsForceEnable, kLayerSettingsDisablePipelinePreCaching};
+    static const char* setting_names[] = {kLayerSettingsForceEnable, kLayerSettingsDisablePipelinePreCaching,
+                                          kLayerSettingsAsyncPipelineCompilation, kLayerSettingsPipelineCachePath,
+                                          kLayerSettingsDrawStateJournal};
     uint32_t setting_name_count = static_cast<uint32_t>(std::size(setting_names));
 
     std::vector<const char*> unknown_settings;
@@ -2094,6 +2805,18 @@ void InitLayerSettings(const VkInstanceCreateInfo* pCreateInfo, const VkAllocati
         vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsDisablePipelinePreCaching, layer_settings->disable_pipeline_pre_caching);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsAsyncPipelineCompilation)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsAsyncPipelineCompilation, layer_settings->async_pipeline_compilation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsPipelineCachePath)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsPipelineCachePath, layer_settings->pipeline_cache_path);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, kLayerSettingsDrawStateJournal)) {
+        vkuGetLayerSettingValue(layer_setting_set, kLayerSettingsDrawStateJournal, layer_settings->draw_state_journal);
+    }
+
     vkuDestroyLayerSettingSet(layer_setting_set, pAllocator);
 }
 
@@ -2613,6 +3336,19 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevi
         if (instance_data->layer_settings.disable_pipeline_pre_caching) {
             device_data->flags |= DeviceData::DISABLE_PIPELINE_PRE_CACHING;
         }
+        if (instance_data->layer_settings.async_pipeline_compilation) {
+            device_data->flags |= DeviceData::ASYNC_PIPELINE_COMPILATION;
+        }
+        device_data->pipeline_cache_path = instance_data->layer_settings.pipeline_cache_path;
+        if (!instance_data->layer_settings.draw_state_journal.empty()) {
+            device_data->flags |= DeviceData::DRAW_STATE_JOURNAL;
+        }
+        auto const cache_control_ptr = reinterpret_cast<VkPhysicalDevicePipelineCreationCacheControlFeatures*>(
+            FindStructureInChain(device_next_chain, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES));
+        if ((vulkan_1_3_ptr && vulkan_1_3_ptr->pipelineCreationCacheControl == VK_TRUE) ||
+            (cache_control_ptr && cache_control_ptr->pipelineCreationCacheControl == VK_TRUE)) {
+            device_data->flags |= DeviceData::HAS_PIPELINE_CREATION_CACHE_CONTROL;
+        }
         device_data->reserved_private_data_slot_count = total_private_data_slot_request_count;
         device_data->enabled_extensions               = enabled_additional_extensions;
 
@@ -2705,6 +3441,16 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevi
         ASSERT(pipeline_layout_result == VK_SUCCESS);
         UNUSED(pipeline_layout_result);
 
+        if (device_data->flags & DeviceData::DRAW_STATE_JOURNAL) {
+            OpenDrawStateJournal(*device_data, instance_data->layer_settings.draw_state_journal);
+        }
+
+        if ((device_data->flags & (DeviceData::ASYNC_PIPELINE_COMPILATION | DeviceData::DRAW_STATE_JOURNAL)) ||
+            !device_data->pipeline_cache_path.empty()) {
+            // Leave some cores to the application's own threads
+            device_data->pipeline_compile_queue.Start(std::max(1u, std::thread::hardware_concurrency() / 2));
+        }
+
         // gather created queues
         for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
             for (uint32_t j = 0; j < pCreateInfo->pQueueCreateInfos[i].queueCount; ++j) {
@@ -2753,7 +3499,16 @@ static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocat
     }
     lock.unlock();
 
-    // Clean up device data resources
+    // Clean up device data resources, background compilations may still use the dummy pipeline layout
+    device_data->pipeline_compile_queue.Stop();
+    if (device_data->draw_state_journal.file != nullptr) {
+        fclose(device_data->draw_state_journal.file);
+    }
+    for (auto libraries : {&device_data->vertex_input_libraries, &device_data->fragment_output_libraries}) {
+        for (auto const& pair : libraries->GetDataUnsafe()) {
+            vtable.DestroyPipeline(device_data->device, pair.value, nullptr);
+        }
+    }
     if (device_data->private_data_slot != VK_NULL_HANDLE) {
         vtable.DestroyPrivateDataSlotEXT(device_data->device, device_data->private_data_slot, &allocator);
     }
@@ -2886,6 +3641,21 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t
         }
     }
 
+    // Only vertex and mesh shader caches are used to create pipelines at draw time
+    if (result == VK_SUCCESS && !device_data.pipeline_cache_path.empty()) {
+        for (uint32_t i = 0; i < successfulCreateCount; ++i) {
+            auto shader = *reinterpret_cast<Shader**>(&pShaders[i]);
+            if (shader->cache != VK_NULL_HANDLE && (shader->stage & (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_MESH_BIT_EXT))) {
+                shader->pipeline_cache_file = PipelineCacheFileName(device_data, *shader);
+                LoadPipelineCacheFile(device_data, *shader);
+            }
+        }
+    }
+
+    if (result == VK_SUCCESS && (device_data.flags & DeviceData::DRAW_STATE_JOURNAL)) {
+        ReplayDrawStateJournal(*device_data_map.Get(device), successfulCreateCount, pShaders);
+    }
+
     if (incompatible_binary) {
         return VK_ERROR_INCOMPATIBLE_SHADER_BINARY_EXT;
     }
@@ -3760,6 +4530,15 @@ static VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(VkDevice device,
 
 static VKAPI_ATTR void VKAPI_CALL FakeCmdSetColorBlendAdvancedEXT(VkCommandBuffer, uint32_t, uint32_t, const VkColorBlendAdvancedEXT*) {}
 
+static VKAPI_ATTR VkResult VKAPI_CALL GetShaderObjectStatisticsKHRONOS(VkDevice device, VkShaderObjectStatisticsKHRONOS* pStatistics) {
+    auto const& statistics = device_data_map.Get(device)->statistics;
+    pStatistics->drawStateLookupCount     = statistics.draw_state_lookups.load(std::memory_order_relaxed);
+    pStatistics->drawTimePipelineCount    = statistics.draw_time_pipelines.load(std::memory_order_relaxed);
+    pStatistics->optimizedPipelineCount   = statistics.optimized_pipelines.load(std::memory_order_relaxed);
+    pStatistics->precompiledPipelineCount = statistics.precompiled_pipelines.load(std::memory_order_relaxed);
+    return VK_SUCCESS;
+}
+
 // Get Proc Addr
 
 struct NameAndFunction {
@@ -3842,6 +4621,10 @@ static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice devic
             }
             return reinterpret_cast<PFN_vkVoidFunction>(shader_object::FakeCmdSetColorBlendAdvancedEXT);
         }
+
+        if (strcmp(pName, "vkGetShaderObjectStatisticsKHRONOS") == 0) {
+            return reinterpret_cast<PFN_vkVoidFunction>(shader_object::GetShaderObjectStatisticsKHRONOS);
+        }
     } else {
         // Even if the layer isn't enabled for this device, destroy device still needs to be called to cleanup device data
         if (strcmp(pName, "vkDestroyDevice") == 0) {
@@ -0,0 +1,39 @@
+/* Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Layer specific entry point of VK_LAYER_KHRONOS_shader_object, available through vkGetDeviceProcAddr when the layer
+// implements VK_EXT_shader_object for the device. Applications copy or include this header.
+
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Totals since the device was created. Subtracting two samples gives the pipeline work of the draws in between.
+typedef struct VkShaderObjectStatisticsKHRONOS {
+    uint64_t drawStateLookupCount;      // Draws that looked up the pipeline of their draw state
+    uint64_t drawTimePipelineCount;     // Pipelines created for draw states on recording threads
+    uint64_t optimizedPipelineCount;    // Optimized pipelines compiled in the background to replace fast-linked ones
+    uint64_t precompiledPipelineCount;  // Pipelines compiled in the background for draw states of the draw state journal
+} VkShaderObjectStatisticsKHRONOS;
+
+typedef VkResult(VKAPI_PTR* PFN_vkGetShaderObjectStatisticsKHRONOS)(VkDevice device, VkShaderObjectStatisticsKHRONOS* pStatistics);
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,14 +19,23 @@
 // clang-format off
 
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <type_traits>
 #include <cassert>
 #include <bitset>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <thread>
+#include <deque>
+#include <atomic>
+#include <string>
+#include <vector>
 #include <functional>
 #include <cstring>
+#include <algorithm>
+#include <iterator>
 
 #include <vulkan/vulkan.h>
 
@@ -796,8 +805,13 @@ struct FullDrawStateData {
 
     static void InitializeMemory(void* memory, VkPhysicalDeviceProperties const& properties,
                                  bool dynamic_rendering_unused_attachments) {
-        FullDrawStateData* state = new (memory) FullDrawStateData{};
+        // Padding and unused array elements stay zero, draw state journal entries store them
         Limits limits(properties);
+        AlignedMemory aligned_memory;
+        ReserveMemory(aligned_memory, limits);
+        memset(memory, 0, aligned_memory.GetSize());
+
+        FullDrawStateData* state = new (memory) FullDrawStateData{};
         SetInternalArrayPointers(state, limits);
         state->limits_ = limits;
 
@@ -898,6 +912,68 @@ struct FullDrawStateData {
 
     Key GetKey() { return Key(this); }
 
+    // Size of the memory holding the state and its arrays, which is what draw state journal entries store
+    size_t GetMemorySize() const {
+        AlignedMemory aligned_memory;
+        ReserveMemory(aligned_memory, limits_);
+        return aligned_memory.GetSize();
+    }
+
+    // Copies the state and its arrays into GetMemorySize() bytes for a draw state journal entry. Pointers, the allocator
+    // and the cached hashes only mean something in this process and are zeroed.
+    void CopyToJournalMemory(void* memory) const {
+        memcpy(memory, this, GetMemorySize());
+
+        auto state = reinterpret_cast<FullDrawStateData*>(memory);
+        state->color_attachment_formats_ = nullptr;
+        state->color_blend_attachment_states_ = nullptr;
+        state->viewport_swizzles_ = nullptr;
+        state->vertex_input_attribute_descriptions_ = nullptr;
+        state->vertex_input_binding_descriptions_ = nullptr;
+        memset(&state->comparable_shaders_, 0, sizeof(state->comparable_shaders_));
+        memset(&state->allocator_, 0, sizeof(state->allocator_));
+        state->final_hash_ = 0;
+        std::fill(std::begin(state->partial_hashes_), std::end(state->partial_hashes_), size_t(0));
+        state->dirty_hash_bits_.set();
+        state->is_dirty_ = true;
+    }
+
+    // Recreates a state from memory that a draw state journal entry stored in another run. The memory is only usable on
+    // a device with the same limits, its array pointers are fixed up and its shaders are replaced.
+    static FullDrawStateData* CreateFromMemory(void const* memory, size_t size, VkPhysicalDeviceProperties const& properties,
+                                               bool dynamic_rendering_unused_attachments, Shader* const shaders[NUM_SHADERS]) {
+        Limits limits(properties);
+        AlignedMemory aligned_memory;
+        ReserveMemory(aligned_memory, limits);
+        if (size != aligned_memory.GetSize()) {
+            return nullptr;
+        }
+        auto allocator = kDefaultAllocator;
+
+        aligned_memory.Allocate(allocator, VkSystemAllocationScope::VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+        if (!aligned_memory) {
+            return nullptr;
+        }
+        memcpy(aligned_memory.GetMemoryWritePtr(), memory, size);
+
+        auto state = aligned_memory.GetNextAlignedPtr<FullDrawStateData>();
+        state->allocator_ = allocator;
+        if (memcmp(&state->limits_, &limits, sizeof(limits)) != 0 ||
+            state->dynamic_rendering_unused_attachments_ != dynamic_rendering_unused_attachments) {
+            Destroy(state);
+            return nullptr;
+        }
+        SetInternalArrayPointers(state, limits);
+        for (uint32_t shader_type = 0; shader_type < NUM_SHADERS; ++shader_type) {
+            state->comparable_shaders_[shader_type] = ComparableShader(shaders[shader_type]);
+        }
+        state->final_hash_ = 0;
+        std::fill(std::begin(state->partial_hashes_), std::end(state->partial_hashes_), size_t(0));
+        state->dirty_hash_bits_.set();
+        state->is_dirty_ = true;
+        return state;
+    }
+
     void MarkDirty() { is_dirty_ = true; }
 
 #include "generated/shader_object_full_draw_state_struct_members.inl"
@@ -946,6 +1022,15 @@ struct PartialPipeline {
     VkShaderStageFlags shader_stages;
 };
 
+// Pipeline that draws with a draw state. The pipeline is VK_NULL_HANDLE while a recording thread creates it. When pipelines
+// are compiled asynchronously, a fast-linked pipeline is used until the optimized pipeline replaces it. The fast-linked
+// pipeline is kept alive for command buffers that already recorded it.
+struct DrawStatePipeline {
+    VkPipeline pipeline             = VK_NULL_HANDLE;
+    VkPipeline fast_linked_pipeline = VK_NULL_HANDLE;
+    bool       optimizing           = false;
+};
+
 struct Shader {
     struct PrivateDataSlotPair {
         VkPrivateDataSlot slot;
@@ -989,13 +1074,18 @@ struct Shader {
 
     VkShaderModule                   shader_module;
     VkShaderStageFlagBits            stage;
+    VkShaderCreateFlagsEXT           create_flags = 0;
     VkPipelineShaderStageCreateFlags flags;
 
     HashMap<VkPrivateDataSlot, uint64_t> private_data;
     PrivateDataSlotPair*                 reserved_private_data_slots;
 
     // Associates draw states related to this shader with pipelines. Only used for shaders that are always present (i.e. vertex or mesh)
-    ReaderWriterContainer<HashMap<FullDrawStateData::Key, VkPipeline, false>> pipelines;
+    ReaderWriterContainer<HashMap<FullDrawStateData::Key, DrawStatePipeline, false>> pipelines;
+
+    // Notified when a recording thread has created the pipeline for a draw state, so that threads drawing with the same
+    // state stop waiting for it. Other draw states don't wait for the creation.
+    std::condition_variable_any pipeline_created;
 
     // Pipeline cache that is generated at create time (if it's not being created from binary) and is copied into cache
     // This gets serialized into the shader binary
@@ -1007,6 +1097,16 @@ struct Shader {
     // Used for draw time pipeline creation
     VkPipelineCache cache = VK_NULL_HANDLE;
 
+    // Identifies the shader in the draw state journal across runs, a checksum of its SPIR-V, stage, create flags and
+    // specialization constants. 0 unless the journal is used.
+    uint64_t journal_id = 0;
+
+    // File that `cache` is stored in and loaded from when the pipeline cache path setting is set, empty otherwise
+    std::string pipeline_cache_file;
+    // Set when `cache` may hold pipelines that are not in the file yet, and the steady clock time of the last write
+    std::atomic<bool>    pipeline_cache_dirty{false};
+    std::atomic<int64_t> pipeline_cache_write_time{0};
+
     // If possible, holds a partial pipeline created with graphics pipeline library at create time that may be used to speed up draw time pipeline creation
     PartialPipeline partial_pipeline;
 };
@@ -1037,12 +1137,68 @@ class ShaderBinary {
     ShaderBinary() = default;
 };
 
+// Worker threads that compile optimized pipelines in the background
+class PipelineCompileQueue {
+  public:
+    using Job = std::function<void()>;
+
+    ~PipelineCompileQueue() { Stop(); }
+
+    void Start(uint32_t num_threads);
+
+    // Discards queued jobs and waits for the running ones to finish
+    void Stop();
+
+    // shaders lists the shaders that the job compiles, indexed by ShaderType
+    void Push(Shader* const shaders[NUM_SHADERS], Job&& job);
+
+    // Discards queued jobs that use the shader and waits for the running ones that use it, so that it can be destroyed.
+    // Jobs the running ones queue for the shader are discarded as well.
+    void Wait(Shader const* shader);
+
+  private:
+    struct Entry {
+        Shader* shaders[NUM_SHADERS];
+        Job     job;
+
+        bool Uses(Shader const* shader) const;
+    };
+
+    void Run();
+
+    std::mutex               mutex_;
+    std::condition_variable  job_available_;
+    std::condition_variable  job_finished_;
+    std::deque<Entry>        queue_;
+    std::vector<Entry*>      running_;
+    std::vector<std::thread> threads_;
+    bool                     stopping_ = false;
+};
+
+// Draw states that needed a pipeline at draw time, along with the shaders they were drawn with. They are appended to the
+// journal file, and pipelines for them are compiled on worker threads when their shaders are created in later runs.
+struct DrawStateJournal {
+    struct Entry {
+        uint64_t             shader_ids[NUM_SHADERS];  // Shader::journal_id, 0 where the draw state has no shader
+        std::vector<uint8_t> state;                    // Memory of the FullDrawStateData
+        bool                 replayed;
+    };
+
+    std::mutex                        mutex;
+    FILE*                             file = nullptr;
+    std::vector<Entry>                entries;
+    HashMap<uint64_t, Shader*, false> shaders;  // Live shaders by journal id
+};
+
 // Data that is specific to a single device
 struct DeviceData {
     enum FlagBits {
-        SHADER_OBJECT_LAYER_ENABLED        = 1u << 0,
-        HAS_PRIMITIVE_TOPLOGY_UNRESTRICTED = 1u << 1,
-        DISABLE_PIPELINE_PRE_CACHING       = 1u << 2,
+        SHADER_OBJECT_LAYER_ENABLED         = 1u << 0,
+        HAS_PRIMITIVE_TOPLOGY_UNRESTRICTED  = 1u << 1,
+        DISABLE_PIPELINE_PRE_CACHING        = 1u << 2,
+        ASYNC_PIPELINE_COMPILATION          = 1u << 3,
+        HAS_PIPELINE_CREATION_CACHE_CONTROL = 1u << 4,
+        DRAW_STATE_JOURNAL                  = 1u << 5,
     };
     using Flags = uint32_t;
 
@@ -1074,6 +1230,28 @@ struct DeviceData {
     };
     HashMap<Shader*, TagInfo>      debug_utils_object_tag_map;
 
+    // Compiles optimized pipelines when ASYNC_PIPELINE_COMPILATION is set. Shaders are destroyed with a const DeviceData.
+    mutable PipelineCompileQueue pipeline_compile_queue;
+
+    // Returned by vkGetShaderObjectStatisticsKHRONOS
+    struct Statistics {
+        std::atomic<uint64_t> draw_state_lookups{0};
+        std::atomic<uint64_t> draw_time_pipelines{0};
+        std::atomic<uint64_t> optimized_pipelines{0};
+        std::atomic<uint64_t> precompiled_pipelines{0};
+    } statistics;
+
+    // Directory the draw time pipeline caches of shaders are stored in, empty when they are not stored
+    std::string pipeline_cache_path;
+
+    // Used when DRAW_STATE_JOURNAL is set. Shaders are destroyed with a const DeviceData.
+    mutable DrawStateJournal draw_state_journal;
+
+    // Vertex input and fragment output interface libraries linked with the shader libraries, keyed by the state they
+    // were created with
+    ReaderWriterContainer<HashMap<std::string, VkPipeline, false>> vertex_input_libraries;
+    ReaderWriterContainer<HashMap<std::string, VkPipeline, false>> fragment_output_libraries;
+
     #include "generated/shader_object_device_data_declare_extension_variables.inl"
 };
 
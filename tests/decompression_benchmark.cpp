@@ -0,0 +1,797 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the throughput of VK_LAYER_KHRONOS_memory_decompression with GPU timestamps. Every shader variant the
+// device can run is selected in turn through the layer settings, with and without the Huffman lookup tables, and each
+// one decompresses generated corpora of different compressibility, split in tiles of different sizes, with
+// vkCmdDecompressMemoryNV calls of different region counts and with a single vkCmdDecompressMemoryIndirectCountNV call.
+// The layer batches consecutive calls into one dispatch unless --batch off is given, which times every call separately.
+
+#define VOLK_IMPLEMENTATION
+#include <volk.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gdeflate.h"
+
+namespace {
+
+const char* const kLayerName = "VK_LAYER_KHRONOS_memory_decompression";
+
+struct Options {
+    size_t size = 0;
+    uint32_t iterations = 5;
+    uint32_t level = gdeflate::kDefaultLevel;
+    uint32_t device_index = 0;
+    uint32_t width = 0;
+    uint32_t tile_size = 0;
+    std::vector<gdeflate::Corpus> corpora;
+    bool csv = false;
+    const char* tuning_file = nullptr;
+    std::vector<bool> huffman_lut = {false, true};
+    bool batch_commands = true;
+};
+
+struct Variant {
+    uint32_t width;
+    bool int16;
+    bool int64;
+    bool huffman_lut;
+};
+
+std::string VariantName(const Variant& variant) {
+    return "w" + std::to_string(variant.width) + (variant.int16 ? "-int16" : "") + (variant.int64 ? "-int64" : "") +
+           (variant.huffman_lut ? "-lut" : "");
+}
+
+// A corpus split in tiles of one size, with the tiles packed back to back
+struct Workload {
+    gdeflate::Corpus corpus;
+    uint32_t tile_size;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> compressed;
+    std::vector<VkDecompressMemoryRegionNV> regions;
+};
+
+struct Buffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceAddress address = 0;
+    void* mapped = nullptr;
+};
+
+#define CHECK_VK(call)                                                              \
+    do {                                                                            \
+        const VkResult check_result = (call);                                       \
+        if (check_result != VK_SUCCESS) {                                           \
+            fprintf(stderr, "benchmark: %s failed with %d\n", #call, check_result); \
+            return false;                                                           \
+        }                                                                           \
+    } while (0)
+
+void PrintUsage() {
+    fprintf(stderr,
+            "usage: vk_decompression_benchmark [-s size] [-i iterations] [-l level] [-d device] [-w width] [-t tile size]\n"
+            "                                  [-c corpus] [--lut on|off] [--batch on|off] [--csv]\n"
+            "                                  [--tune file]\n"
+            "\n"
+            "  -s size        bytes of every corpus with an optional K or M suffix, default 4M or 1M with --tune\n"
+            "  -i iterations  timed runs of every measurement, the median is reported, default 5\n"
+            "  -l level       compression level from %u to %u, default %u\n"
+            "  -d device      index of the physical device, default 0\n"
+            "  -w width       only run the shader variants of this width: 8, 16, 32 or 64\n"
+            "  -t tile size   only run this tile size: 16K, 32K or 64K\n"
+            "  -c corpus      only run this corpus, can be repeated: text, texture, mesh, random or incompressible\n"
+            "  --lut on|off   only run the variants with or without the Huffman lookup tables\n"
+            "  --batch on|off let the layer record consecutive vkCmdDecompressMemoryNV calls as one dispatch, default on\n"
+            "  --csv          print comma separated values instead of a table\n"
+            "  --tune file    time every variant decompressing all corpora in one call and record the fastest for this\n"
+            "                 device in file, which the layer reads through its tuning_file setting\n"
+            "\n"
+            "The layer is found through VK_LAYER_PATH like for vk_extension_layer_tests.\n",
+            gdeflate::kMinLevel, gdeflate::kMaxLevel, gdeflate::kDefaultLevel);
+}
+
+bool ParseUint(const char* text, uint64_t max, uint64_t* value) {
+    char* end = nullptr;
+    const unsigned long long parsed = strtoull(text, &end, 10);
+    uint64_t scale = 1;
+    if (*end == 'K' || *end == 'k') scale = 1024;
+    if (*end == 'M' || *end == 'm') scale = 1024 * 1024;
+    if (scale != 1) ++end;
+    if (end == text || *end != '\0' || parsed > max / scale) return false;
+    *value = parsed * scale;
+    return true;
+}
+
+bool ParseOptions(int argc, char** argv, Options* options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--csv") == 0) {
+            options->csv = true;
+            continue;
+        }
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        uint64_t number = 0;
+        if (strcmp(arg, "--tune") == 0) {
+            options->tuning_file = value;
+            continue;
+        }
+        if (strcmp(arg, "--lut") == 0) {
+            if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) return false;
+            options->huffman_lut = {strcmp(value, "on") == 0};
+            continue;
+        }
+        if (strcmp(arg, "--batch") == 0) {
+            if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) return false;
+            options->batch_commands = strcmp(value, "on") == 0;
+            continue;
+        }
+        if (strcmp(arg, "-s") == 0 && ParseUint(value, 1024ull * 1024 * 1024, &number) && number > 0) {
+            options->size = static_cast<size_t>(number);
+        } else if (strcmp(arg, "-i") == 0 && ParseUint(value, 1000, &number) && number > 0) {
+            options->iterations = static_cast<uint32_t>(number);
+        } else if (strcmp(arg, "-l") == 0 && ParseUint(value, gdeflate::kMaxLevel, &number)) {
+            options->level = static_cast<uint32_t>(number);
+        } else if (strcmp(arg, "-d") == 0 && ParseUint(value, UINT32_MAX, &number)) {
+            options->device_index = static_cast<uint32_t>(number);
+        } else if (strcmp(arg, "-w") == 0 && ParseUint(value, 64, &number) &&
+                   (number == 8 || number == 16 || number == 32 || number == 64)) {
+            options->width = static_cast<uint32_t>(number);
+        } else if (strcmp(arg, "-t") == 0 && ParseUint(value, gdeflate::kTileSize, &number) &&
+                   (number == 16 * 1024 || number == 32 * 1024 || number == 64 * 1024)) {
+            options->tile_size = static_cast<uint32_t>(number);
+        } else if (strcmp(arg, "-c") == 0) {
+            gdeflate::Corpus corpus;
+            if (!gdeflate::ParseCorpus(value, &corpus)) return false;
+            options->corpora.push_back(corpus);
+        } else {
+            return false;
+        }
+    }
+    if (options->size == 0) {
+        options->size = options->tuning_file != nullptr ? 1024 * 1024 : 4 * 1024 * 1024;
+    }
+    if (options->corpora.empty()) {
+        options->corpora = {gdeflate::Corpus::kText, gdeflate::Corpus::kTexture, gdeflate::Corpus::kMesh, gdeflate::Corpus::kRandom,
+                            gdeflate::Corpus::kIncompressible};
+    }
+    return true;
+}
+
+bool PrepareWorkload(gdeflate::Corpus corpus, uint32_t tile_size, const Options& options, Workload* workload) {
+    workload->corpus = corpus;
+    workload->tile_size = tile_size;
+    gdeflate::GenerateCorpus(corpus, options.size, 1, &workload->data);
+    for (size_t offset = 0; offset < workload->data.size(); offset += tile_size) {
+        const size_t size = std::min<size_t>(tile_size, workload->data.size() - offset);
+        const size_t src_offset = workload->compressed.size();
+        if (!gdeflate::CompressTile(workload->data.data() + offset, size, options.level, &workload->compressed)) {
+            fprintf(stderr, "benchmark: cannot compress the %s corpus\n", gdeflate::CorpusName(corpus));
+            return false;
+        }
+        // Addresses are filled in once the buffers exist
+        workload->regions.push_back({src_offset, offset, workload->compressed.size() - src_offset, size,
+                                     VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV});
+    }
+    return true;
+}
+
+class Benchmark {
+  public:
+    explicit Benchmark(const Options& options) : options_(options) {}
+    ~Benchmark() { Destroy(); }
+
+    // Creates an instance with the layer configured for the variant, and a device on the selected physical device
+    bool Init(const Variant& variant);
+    void Destroy();
+
+    // Shader variants the selected device can run, queried without creating a device, and its pipeline cache UUID
+    bool QueryVariants(std::vector<Variant>* variants, std::string* uuid);
+
+    // Reports every measurement of the workload, or only adds the time of a single call decompressing all of it to
+    // tuning_seconds if not null
+    bool Run(const Variant& variant, Workload& workload, double* tuning_seconds = nullptr);
+
+  private:
+    bool CreateInstance(const Variant& variant);
+    bool CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, bool host_visible, Buffer* buffer);
+    void DestroyBuffer(Buffer* buffer);
+    bool Submit(VkCommandBuffer command_buffer);
+    bool Upload(const Buffer& dst, const void* data, VkDeviceSize size);
+    void RecordDecompression(VkCommandBuffer command_buffer, const Workload& workload, uint32_t regions_per_call,
+                             const Buffer& args);
+    bool Validate(const Workload& workload, uint32_t regions_per_call, const Buffer& args, const Buffer& dst);
+    bool Measure(const Workload& workload, uint32_t regions_per_call, const Buffer& args, double* seconds);
+    void Report(const Variant& variant, const Workload& workload, const char* path, size_t regions, double seconds) const;
+
+    const Options& options_;
+    VkInstance instance_ = VK_NULL_HANDLE;
+    VkPhysicalDevice physical_device_ = VK_NULL_HANDLE;
+    VkDevice device_ = VK_NULL_HANDLE;
+    VkQueue queue_ = VK_NULL_HANDLE;
+    uint32_t queue_family_ = 0;
+    VkCommandPool command_pool_ = VK_NULL_HANDLE;
+    VkCommandBuffer command_buffer_ = VK_NULL_HANDLE;
+    VkFence fence_ = VK_NULL_HANDLE;
+    VkQueryPool query_pool_ = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties memory_properties_{};
+    double timestamp_period_ = 1.0;
+    uint64_t timestamp_mask_ = ~0ull;
+    Buffer src_;
+    Buffer dst_;
+};
+
+bool Benchmark::CreateInstance(const Variant& variant) {
+    uint32_t layer_count = 0;
+    vkEnumerateInstanceLayerProperties(&layer_count, nullptr);
+    std::vector<VkLayerProperties> layers(layer_count);
+    vkEnumerateInstanceLayerProperties(&layer_count, layers.data());
+    auto is_layer = [](const VkLayerProperties& layer) { return strcmp(layer.layerName, kLayerName) == 0; };
+    if (std::none_of(layers.begin(), layers.end(), is_layer)) {
+        fprintf(stderr, "benchmark: %s not found, set VK_LAYER_PATH to the directory holding its manifest\n", kLayerName);
+        return false;
+    }
+
+    // Force the layer on so that drivers implementing the extension still run the variant being measured
+    const VkBool32 force_enable = VK_TRUE;
+    const VkBool32 int16 = variant.int16, int64 = variant.int64, huffman_lut = variant.huffman_lut;
+    const VkBool32 batch_commands = options_.batch_commands;
+    const VkLayerSettingEXT settings[] = {
+        {kLayerName, "force_enable", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &force_enable},
+        {kLayerName, "shader_simd_width", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &variant.width},
+        {kLayerName, "shader_int16", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &int16},
+        {kLayerName, "shader_int64", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &int64},
+        {kLayerName, "huffman_lut", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &huffman_lut},
+        {kLayerName, "batch_commands", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &batch_commands}};
+    VkLayerSettingsCreateInfoEXT settings_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                  static_cast<uint32_t>(std::size(settings)), settings};
+
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "vk_decompression_benchmark";
+    app_info.apiVersion = VK_API_VERSION_1_3;
+
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, &settings_info};
+    instance_info.pApplicationInfo = &app_info;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = &kLayerName;
+    CHECK_VK(vkCreateInstance(&instance_info, nullptr, &instance_));
+    volkLoadInstance(instance_);
+
+    uint32_t device_count = 0;
+    CHECK_VK(vkEnumeratePhysicalDevices(instance_, &device_count, nullptr));
+    std::vector<VkPhysicalDevice> devices(device_count);
+    CHECK_VK(vkEnumeratePhysicalDevices(instance_, &device_count, devices.data()));
+    if (options_.device_index >= device_count) {
+        fprintf(stderr, "benchmark: there are %u physical devices, %u is out of range\n", device_count, options_.device_index);
+        return false;
+    }
+    physical_device_ = devices[options_.device_index];
+    return true;
+}
+
+bool Benchmark::QueryVariants(std::vector<Variant>* variants, std::string* uuid) {
+    if (!CreateInstance({0, true, true, false})) return false;
+
+    VkPhysicalDeviceProperties2 props = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+    VkPhysicalDeviceSubgroupSizeControlProperties size_props = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES};
+    props.pNext = &size_props;
+    vkGetPhysicalDeviceProperties2(physical_device_, &props);
+
+    VkPhysicalDeviceFeatures2 features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+    VkPhysicalDeviceSubgroupSizeControlFeatures size_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES};
+    features.pNext = &size_features;
+    vkGetPhysicalDeviceFeatures2(physical_device_, &features);
+
+    uuid->clear();
+    for (const uint8_t byte : props.properties.pipelineCacheUUID) {
+        char hex[3];
+        snprintf(hex, sizeof(hex), "%02x", byte);
+        *uuid += hex;
+    }
+
+    if (!options_.csv) {
+        printf("%s, subgroup sizes %u to %u%s\n\n", props.properties.deviceName, size_props.minSubgroupSize,
+               size_props.maxSubgroupSize, size_features.subgroupSizeControl ? "" : " without size control");
+    }
+
+    // Same rules as the layer uses to accept a forced width
+    for (const uint32_t width : {8u, 16u, 32u, 64u}) {
+        if (options_.width != 0 && options_.width != width) continue;
+        if (width != 8 && !(size_features.subgroupSizeControl && width >= size_props.minSubgroupSize &&
+                            width <= size_props.maxSubgroupSize)) {
+            continue;
+        }
+        for (const bool int64 : {false, true}) {
+            if (int64 && !features.features.shaderInt64) continue;
+            for (const bool int16 : {false, true}) {
+                if (int16 && !features.features.shaderInt16) continue;
+                for (const bool huffman_lut : options_.huffman_lut) {
+                    variants->push_back({width, int16, int64, huffman_lut});
+                }
+            }
+        }
+    }
+    Destroy();
+    return true;
+}
+
+bool Benchmark::Init(const Variant& variant) {
+    if (!CreateInstance(variant)) return false;
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physical_device_, &props);
+    vkGetPhysicalDeviceMemoryProperties(physical_device_, &memory_properties_);
+    timestamp_period_ = props.limits.timestampPeriod;
+    if (props.apiVersion < VK_API_VERSION_1_2) {
+        fprintf(stderr, "benchmark: %s only supports Vulkan %u.%u, 1.2 is needed\n", props.deviceName,
+                VK_API_VERSION_MAJOR(props.apiVersion), VK_API_VERSION_MINOR(props.apiVersion));
+        return false;
+    }
+
+    uint32_t family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physical_device_, &family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(physical_device_, &family_count, families.data());
+    queue_family_ = family_count;
+    for (uint32_t i = 0; i < family_count; ++i) {
+        if ((families[i].queueFlags & VK_QUEUE_COMPUTE_BIT) && families[i].timestampValidBits != 0) {
+            queue_family_ = i;
+            break;
+        }
+    }
+    if (queue_family_ == family_count) {
+        fprintf(stderr, "benchmark: %s has no compute queue with timestamps\n", props.deviceName);
+        return false;
+    }
+    const uint32_t valid_bits = families[queue_family_].timestampValidBits;
+    timestamp_mask_ = valid_bits >= 64 ? ~0ull : (1ull << valid_bits) - 1;
+
+    uint32_t extension_count = 0;
+    CHECK_VK(vkEnumerateDeviceExtensionProperties(physical_device_, nullptr, &extension_count, nullptr));
+    std::vector<VkExtensionProperties> extensions(extension_count);
+    CHECK_VK(vkEnumerateDeviceExtensionProperties(physical_device_, nullptr, &extension_count, extensions.data()));
+    auto has_extension = [&](const char* name) {
+        return std::any_of(extensions.begin(), extensions.end(),
+                           [name](const VkExtensionProperties& extension) { return strcmp(extension.extensionName, name) == 0; });
+    };
+    std::vector<const char*> enabled_extensions = {VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME};
+    if (!has_extension(VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME)) {
+        fprintf(stderr, "benchmark: %s is not exposed on %s\n", VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME, props.deviceName);
+        return false;
+    }
+    const bool size_control = props.apiVersion >= VK_API_VERSION_1_3 || has_extension(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+    if (props.apiVersion < VK_API_VERSION_1_3 && size_control) {
+        enabled_extensions.push_back(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
+    }
+
+    // Enable everything the layer and its shader variants may use
+    VkPhysicalDeviceMemoryDecompressionFeaturesNV decompression_features = {
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_NV};
+    VkPhysicalDeviceVulkan12Features vulkan12_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+    VkPhysicalDeviceSubgroupSizeControlFeatures size_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES};
+    VkPhysicalDeviceFeatures2 features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+    features.pNext = &decompression_features;
+    decompression_features.pNext = &vulkan12_features;
+    if (size_control) vulkan12_features.pNext = &size_features;
+    vkGetPhysicalDeviceFeatures2(physical_device_, &features);
+    if (!decompression_features.memoryDecompression || !vulkan12_features.bufferDeviceAddress) {
+        fprintf(stderr, "benchmark: %s does not support memory decompression\n", props.deviceName);
+        return false;
+    }
+
+    VkPhysicalDeviceFeatures2 enabled_features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, &decompression_features};
+    enabled_features.features.shaderInt16 = features.features.shaderInt16;
+    enabled_features.features.shaderInt64 = features.features.shaderInt64;
+    VkPhysicalDeviceVulkan12Features enabled12 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, vulkan12_features.pNext};
+    enabled12.bufferDeviceAddress = VK_TRUE;
+    enabled12.shaderInt8 = vulkan12_features.shaderInt8;
+    enabled12.storageBuffer8BitAccess = vulkan12_features.storageBuffer8BitAccess;
+    decompression_features.pNext = &enabled12;
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueFamilyIndex = queue_family_;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, &enabled_features};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    device_info.enabledExtensionCount = static_cast<uint32_t>(enabled_extensions.size());
+    device_info.ppEnabledExtensionNames = enabled_extensions.data();
+    CHECK_VK(vkCreateDevice(physical_device_, &device_info, nullptr, &device_));
+    volkLoadDevice(device_);
+    vkGetDeviceQueue(device_, queue_family_, 0, &queue_);
+
+    VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = queue_family_;
+    CHECK_VK(vkCreateCommandPool(device_, &pool_info, nullptr, &command_pool_));
+
+    VkCommandBufferAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    allocate_info.commandPool = command_pool_;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    CHECK_VK(vkAllocateCommandBuffers(device_, &allocate_info, &command_buffer_));
+
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    CHECK_VK(vkCreateFence(device_, &fence_info, nullptr, &fence_));
+
+    VkQueryPoolCreateInfo query_info = {VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+    query_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_info.queryCount = 2;
+    CHECK_VK(vkCreateQueryPool(device_, &query_info, nullptr, &query_pool_));
+    return true;
+}
+
+void Benchmark::Destroy() {
+    if (device_ != VK_NULL_HANDLE) {
+        vkDeviceWaitIdle(device_);
+        DestroyBuffer(&src_);
+        DestroyBuffer(&dst_);
+        vkDestroyQueryPool(device_, query_pool_, nullptr);
+        vkDestroyFence(device_, fence_, nullptr);
+        vkDestroyCommandPool(device_, command_pool_, nullptr);
+        vkDestroyDevice(device_, nullptr);
+        device_ = VK_NULL_HANDLE;
+    }
+    if (instance_ != VK_NULL_HANDLE) {
+        vkDestroyInstance(instance_, nullptr);
+        instance_ = VK_NULL_HANDLE;
+    }
+}
+
+bool Benchmark::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, bool host_visible, Buffer* buffer) {
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = size;
+    buffer_info.usage = usage | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    CHECK_VK(vkCreateBuffer(device_, &buffer_info, nullptr, &buffer->buffer));
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device_, buffer->buffer, &requirements);
+
+    // Device local memory for the data the kernels touch, host coherent memory for everything the host reads or writes
+    const VkMemoryPropertyFlags wanted = host_visible ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+                                                      : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    uint32_t type_index = memory_properties_.memoryTypeCount;
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if ((requirements.memoryTypeBits & (1u << i)) && (memory_properties_.memoryTypes[i].propertyFlags & wanted) == wanted) {
+            type_index = i;
+            break;
+        }
+    }
+    if (type_index == memory_properties_.memoryTypeCount) {
+        fprintf(stderr, "benchmark: no memory type for a %llu byte buffer\n", static_cast<unsigned long long>(size));
+        return false;
+    }
+
+    VkMemoryAllocateFlagsInfo flags_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO};
+    flags_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, &flags_info};
+    allocate_info.allocationSize = requirements.size;
+    allocate_info.memoryTypeIndex = type_index;
+    CHECK_VK(vkAllocateMemory(device_, &allocate_info, nullptr, &buffer->memory));
+    CHECK_VK(vkBindBufferMemory(device_, buffer->buffer, buffer->memory, 0));
+    if (host_visible) {
+        CHECK_VK(vkMapMemory(device_, buffer->memory, 0, VK_WHOLE_SIZE, 0, &buffer->mapped));
+    }
+
+    VkBufferDeviceAddressInfo address_info = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO};
+    address_info.buffer = buffer->buffer;
+    buffer->address = vkGetBufferDeviceAddress(device_, &address_info);
+    return true;
+}
+
+void Benchmark::DestroyBuffer(Buffer* buffer) {
+    vkDestroyBuffer(device_, buffer->buffer, nullptr);
+    vkFreeMemory(device_, buffer->memory, nullptr);
+    *buffer = Buffer();
+}
+
+bool Benchmark::Submit(VkCommandBuffer command_buffer) {
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    CHECK_VK(vkQueueSubmit(queue_, 1, &submit_info, fence_));
+    CHECK_VK(vkWaitForFences(device_, 1, &fence_, VK_TRUE, UINT64_MAX));
+    CHECK_VK(vkResetFences(device_, 1, &fence_));
+    return true;
+}
+
+bool Benchmark::Upload(const Buffer& dst, const void* data, VkDeviceSize size) {
+    Buffer staging;
+    if (!CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, true, &staging)) return false;
+    memcpy(staging.mapped, data, static_cast<size_t>(size));
+
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    CHECK_VK(vkBeginCommandBuffer(command_buffer_, &begin_info));
+    const VkBufferCopy region = {0, 0, size};
+    vkCmdCopyBuffer(command_buffer_, staging.buffer, dst.buffer, 1, &region);
+    CHECK_VK(vkEndCommandBuffer(command_buffer_));
+    const bool ok = Submit(command_buffer_);
+    DestroyBuffer(&staging);
+    return ok;
+}
+
+// Decompresses the whole workload, either with calls of regions_per_call regions or, for zero, with one indirect call
+// reading the regions and their count from args
+void Benchmark::RecordDecompression(VkCommandBuffer command_buffer, const Workload& workload, uint32_t regions_per_call,
+                                    const Buffer& args) {
+    const uint32_t count = static_cast<uint32_t>(workload.regions.size());
+    if (regions_per_call == 0) {
+        vkCmdDecompressMemoryIndirectCountNV(command_buffer, args.address + sizeof(uint32_t) * 4, args.address,
+                                             sizeof(VkDecompressMemoryRegionNV));
+        return;
+    }
+    const VkDecompressMemoryRegionNV* regions = static_cast<const VkDecompressMemoryRegionNV*>(args.mapped) + 1;
+    for (uint32_t first = 0; first < count; first += regions_per_call) {
+        vkCmdDecompressMemoryNV(command_buffer, std::min(regions_per_call, count - first), regions + first);
+    }
+}
+
+bool Benchmark::Validate(const Workload& workload, uint32_t regions_per_call, const Buffer& args, const Buffer& dst) {
+    Buffer readback;
+    if (!CreateBuffer(workload.data.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, &readback)) return false;
+
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    CHECK_VK(vkBeginCommandBuffer(command_buffer_, &begin_info));
+    vkCmdFillBuffer(command_buffer_, dst.buffer, 0, VK_WHOLE_SIZE, 0);
+
+    VkMemoryBarrier barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(command_buffer_, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0,
+                         nullptr, 0, nullptr);
+    RecordDecompression(command_buffer_, workload, regions_per_call, args);
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(command_buffer_, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                         nullptr, 0, nullptr);
+
+    const VkBufferCopy region = {0, 0, workload.data.size()};
+    vkCmdCopyBuffer(command_buffer_, dst.buffer, readback.buffer, 1, &region);
+    CHECK_VK(vkEndCommandBuffer(command_buffer_));
+
+    bool ok = Submit(command_buffer_);
+    if (ok && memcmp(readback.mapped, workload.data.data(), workload.data.size()) != 0) {
+        fprintf(stderr, "benchmark: wrong output for the %s corpus in %u byte tiles\n", gdeflate::CorpusName(workload.corpus),
+                workload.tile_size);
+        ok = false;
+    }
+    DestroyBuffer(&readback);
+    return ok;
+}
+
+bool Benchmark::Measure(const Workload& workload, uint32_t regions_per_call, const Buffer& args, double* seconds) {
+    // Recorded once, the layer keeps the region arrays it uploads alive until the command buffer is reset
+    CHECK_VK(vkResetCommandBuffer(command_buffer_, 0));
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    CHECK_VK(vkBeginCommandBuffer(command_buffer_, &begin_info));
+    vkCmdResetQueryPool(command_buffer_, query_pool_, 0, 2);
+    vkCmdWriteTimestamp(command_buffer_, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, query_pool_, 0);
+    RecordDecompression(command_buffer_, workload, regions_per_call, args);
+    vkCmdWriteTimestamp(command_buffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool_, 1);
+    CHECK_VK(vkEndCommandBuffer(command_buffer_));
+
+    std::vector<double> times;
+    for (uint32_t i = 0; i < options_.iterations; ++i) {
+        if (!Submit(command_buffer_)) return false;
+        uint64_t timestamps[2];
+        CHECK_VK(vkGetQueryPoolResults(device_, query_pool_, 0, 2, sizeof(timestamps), timestamps, sizeof(uint64_t),
+                                       VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+        const uint64_t ticks = (timestamps[1] - timestamps[0]) & timestamp_mask_;
+        times.push_back(static_cast<double>(ticks) * timestamp_period_ * 1e-9);
+    }
+    std::sort(times.begin(), times.end());
+    *seconds = times[times.size() / 2];
+    return true;
+}
+
+void PrintHeader(const Options& options) {
+    if (options.csv) {
+        printf("variant,path,corpus,tile_size,regions_per_call,ratio,input_gbps,output_gbps\n");
+    } else {
+        printf("%-22s %-9s %-15s %5s %8s %6s %9s %9s\n", "variant", "path", "corpus", "tile", "regions", "ratio", "in GB/s",
+               "out GB/s");
+    }
+}
+
+void Benchmark::Report(const Variant& variant, const Workload& workload, const char* path, size_t regions, double seconds) const {
+    const std::string name = VariantName(variant);
+    const double ratio = static_cast<double>(workload.compressed.size()) / static_cast<double>(workload.data.size());
+    const double input = seconds > 0 ? static_cast<double>(workload.compressed.size()) / seconds * 1e-9 : 0;
+    const double output = seconds > 0 ? static_cast<double>(workload.data.size()) / seconds * 1e-9 : 0;
+
+    if (options_.csv) {
+        printf("%s,%s,%s,%u,%zu,%.4f,%.4f,%.4f\n", name.c_str(), path, gdeflate::CorpusName(workload.corpus), workload.tile_size,
+               regions, ratio, input, output);
+    } else {
+        printf("%-22s %-9s %-15s %4uK %8zu %6.3f %9.3f %9.3f\n", name.c_str(), path, gdeflate::CorpusName(workload.corpus),
+               workload.tile_size / 1024, regions, ratio, input, output);
+    }
+    fflush(stdout);
+}
+
+bool Benchmark::Run(const Variant& variant, Workload& workload, double* tuning_seconds) {
+    if (!CreateBuffer(workload.compressed.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, false, &src_) ||
+        !CreateBuffer(workload.data.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, false, &dst_) ||
+        !Upload(src_, workload.compressed.data(), workload.compressed.size())) {
+        return false;
+    }
+
+    // The region count followed by the regions, with their absolute addresses, for both the direct calls and the
+    // indirect call. The count takes a whole region slot to keep the regions aligned.
+    const uint32_t count = static_cast<uint32_t>(workload.regions.size());
+    Buffer args;
+    if (!CreateBuffer(sizeof(VkDecompressMemoryRegionNV) * (count + 1), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, true, &args)) {
+        return false;
+    }
+    memset(args.mapped, 0, sizeof(VkDecompressMemoryRegionNV));
+    memcpy(args.mapped, &count, sizeof(count));
+    VkDecompressMemoryRegionNV* regions = static_cast<VkDecompressMemoryRegionNV*>(args.mapped) + 1;
+    for (uint32_t i = 0; i < count; ++i) {
+        regions[i] = workload.regions[i];
+        regions[i].srcAddress += src_.address;
+        regions[i].dstAddress += dst_.address;
+    }
+
+    std::vector<uint32_t> batches = {1, 16, 256, count};
+    batches.erase(std::remove_if(batches.begin(), batches.end(), [count](uint32_t batch) { return batch > count; }), batches.end());
+    batches.erase(std::unique(batches.begin(), batches.end()), batches.end());
+    batches.push_back(0);
+    if (tuning_seconds != nullptr) {
+        batches = {count};
+    }
+
+    bool ok = true;
+    for (const uint32_t batch : batches) {
+        double seconds = 0;
+        ok = Validate(workload, batch, args, dst_) && Measure(workload, batch, args, &seconds);
+        if (!ok) break;
+        if (tuning_seconds != nullptr) {
+            *tuning_seconds += seconds;
+        } else {
+            Report(variant, workload, batch == 0 ? "indirect" : "direct", batch == 0 ? count : batch, seconds);
+        }
+    }
+
+    vkDeviceWaitIdle(device_);
+    DestroyBuffer(&args);
+    DestroyBuffer(&src_);
+    DestroyBuffer(&dst_);
+    return ok;
+}
+
+// Replaces the line of the device in the tuning file, keeping the lines of other devices
+bool WriteTuning(const char* path, const std::string& uuid, const Variant& variant) {
+    std::vector<std::string> lines;
+    if (FILE* file = fopen(path, "r")) {
+        char line[256];
+        while (fgets(line, sizeof(line), file) != nullptr) {
+            if (strncmp(line, uuid.c_str(), uuid.size()) != 0) lines.push_back(line);
+        }
+        fclose(file);
+    }
+    lines.push_back(uuid + " " + std::to_string(variant.width) + " " + (variant.int16 ? "1" : "0") + " " +
+                    (variant.int64 ? "1" : "0") + " " + (variant.huffman_lut ? "1" : "0") + "\n");
+
+    FILE* file = fopen(path, "w");
+    if (file == nullptr) {
+        fprintf(stderr, "benchmark: cannot create %s\n", path);
+        return false;
+    }
+    bool ok = true;
+    for (const std::string& line : lines) {
+        ok = ok && fputs(line.c_str(), file) >= 0;
+    }
+    if (fclose(file) != 0 || !ok) {
+        fprintf(stderr, "benchmark: cannot write %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+int Tune(const Options& options, const std::vector<Variant>& variants, const std::string& uuid,
+         std::vector<Workload>& workloads) {
+    size_t bytes = 0;
+    for (const Workload& workload : workloads) {
+        bytes += workload.data.size();
+    }
+
+    const Variant* best = nullptr;
+    double best_seconds = 0;
+    for (const Variant& variant : variants) {
+        Benchmark benchmark(options);
+        if (!benchmark.Init(variant)) return 1;
+        double seconds = 0;
+        for (Workload& workload : workloads) {
+            if (!benchmark.Run(variant, workload, &seconds)) return 1;
+        }
+        const double output = seconds > 0 ? static_cast<double>(bytes) / seconds * 1e-9 : 0;
+        printf("%-22s %9.3f out GB/s\n", VariantName(variant).c_str(), output);
+        if (best == nullptr || seconds < best_seconds) {
+            best = &variant;
+            best_seconds = seconds;
+        }
+    }
+
+    if (!WriteTuning(options.tuning_file, uuid, *best)) return 1;
+    printf("\n%s is the fastest, recorded in %s\n", VariantName(*best).c_str(), options.tuning_file);
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, &options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    if (volkInitialize() != VK_SUCCESS) {
+        fprintf(stderr, "benchmark: cannot load the Vulkan loader\n");
+        return 1;
+    }
+
+    // Tuning measures the tile size of GDeflate streams unless told otherwise
+    uint32_t selected_tile_size = options.tile_size;
+    if (selected_tile_size == 0 && options.tuning_file != nullptr) selected_tile_size = gdeflate::kTileSize;
+
+    std::vector<Workload> workloads;
+    for (const gdeflate::Corpus corpus : options.corpora) {
+        for (const uint32_t tile_size : {16u * 1024, 32u * 1024, 64u * 1024}) {
+            if (selected_tile_size != 0 && selected_tile_size != tile_size) continue;
+            workloads.emplace_back();
+            if (!PrepareWorkload(corpus, tile_size, options, &workloads.back())) return 1;
+        }
+    }
+
+    std::vector<Variant> variants;
+    std::string uuid;
+    {
+        Benchmark probe(options);
+        if (!probe.QueryVariants(&variants, &uuid)) return 1;
+    }
+    if (variants.empty()) {
+        fprintf(stderr, "benchmark: the device cannot run any of the requested shader variants\n");
+        return 1;
+    }
+
+    if (options.tuning_file != nullptr) {
+        return Tune(options, variants, uuid, workloads);
+    }
+
+    PrintHeader(options);
+    for (const Variant& variant : variants) {
+        Benchmark benchmark(options);
+        if (!benchmark.Init(variant)) return 1;
+        for (Workload& workload : workloads) {
+            if (!benchmark.Run(variant, workload)) return 1;
+        }
+    }
+    return 0;
+}
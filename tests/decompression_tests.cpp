@@ -17,17 +17,22 @@
  * Author: Vikram Kushwaha <vkushwaha@nvidia.com>
  */
 
+#include <algorithm>
 #include <type_traits>
 
 #include "extension_layer_tests.h"
 #include "decompression_tests.h"
 #include "decompression_data.h"
+#include "decompression_host.h"
+#include "decompression_statistics.h"
 
 void DecompressionTest::SetUp() {
     VkBool32 force_enable = VK_TRUE;
+    VkBool32 instrumentation = VK_TRUE;
 
     VkLayerSettingEXT settings[] = {
-        {"VK_LAYER_KHRONOS_memory_decompression", "force_enable", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &force_enable}};
+        {"VK_LAYER_KHRONOS_memory_decompression", "force_enable", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &force_enable},
+        {"VK_LAYER_KHRONOS_memory_decompression", "instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &instrumentation}};
 
     VkLayerSettingsCreateInfoEXT layer_settings_create_info{VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
                                                             static_cast<uint32_t>(std::size(settings)), &settings[0]};
@@ -125,6 +130,94 @@ TEST_F(DecompressionTest, DecompressMemory) {
     vkDestroyCommandPool(m_device->device(), command_pool, NULL);
 }
 
+TEST_F(DecompressionTest, DecompressMemoryPackedRegions) {
+    TEST_DESCRIPTION("Test vkCmdDecompressMemoryNV with regions packed at dword granularity.");
+    VkResult result = VK_SUCCESS;
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState()) {
+        GTEST_SKIP() << kSkipPrefix << " decompression not supported, skipping test";
+    }
+
+    VkConstantBufferObj srcBuffer1(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer1.initialized());
+
+    VkConstantBufferObj srcBuffer2(m_device, COMPRESSED_SIZE2, compressedData2, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer2.initialized());
+
+    // The kernels stage their output in shared memory and store whole dwords. The partial last dword of a region must
+    // leave the bytes after the region alone, and the next region starts in the dword that follows.
+    const VkDeviceSize packedSize = (DECOMPRESSED_SIZE + 3) & ~3;
+    std::vector<uint8_t> decompressData(2 * DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, 2 * DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        VkBufferDeviceAddressInfo srcBufferAddr1 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer1.handle()};
+        VkBufferDeviceAddressInfo srcBufferAddr2 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer2.handle()};
+        VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+
+        VkDecompressMemoryRegionNV region[2] = {};
+        region[0].compressedSize = COMPRESSED_SIZE1;
+        region[0].decompressedSize = DECOMPRESSED_SIZE;
+        region[0].srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr1);
+        region[0].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr);
+        region[0].decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV;
+        region[1].compressedSize = COMPRESSED_SIZE2;
+        region[1].decompressedSize = DECOMPRESSED_SIZE;
+        region[1].srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr2);
+        region[1].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr) + packedSize;
+        region[1].decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV;
+
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdDecompressMemoryNV(command_buffer, 2, &region[0]);
+        vkEndCommandBuffer(command_buffer);
+    }
+    {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vkQueueWaitIdle(queue);
+    {
+        uint8_t *decompressedDataResult = static_cast<uint8_t *>(dstBuffer.memory().map());
+        const auto untouched = [](uint8_t value) { return value == 0xFF; };
+        ASSERT_TRUE(memcmp(decompressedDataResult, decompressedData, DECOMPRESSED_SIZE) == 0);
+        ASSERT_TRUE(std::all_of(decompressedDataResult + DECOMPRESSED_SIZE, decompressedDataResult + packedSize, untouched));
+        ASSERT_TRUE(memcmp(decompressedDataResult + packedSize, decompressedData, DECOMPRESSED_SIZE) == 0);
+        ASSERT_TRUE(std::all_of(decompressedDataResult + packedSize + DECOMPRESSED_SIZE,
+                                decompressedDataResult + 2 * DECOMPRESSED_SIZE_ALIGNED, untouched));
+        dstBuffer.memory().unmap();
+    }
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+}
+
 TEST_F(DecompressionTest, DecompressMemoryIndirect) {
     TEST_DESCRIPTION("Test vkCmdDecompressMemoryIndirectCountNV.");
 
@@ -224,3 +317,566 @@ TEST_F(DecompressionTest, DecompressMemoryIndirect) {
     vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
     vkDestroyCommandPool(m_device->device(), command_pool, NULL);
 }
+
+TEST_F(DecompressionTest, DecompressMemoryIndirectCountBelowGrid) {
+    TEST_DESCRIPTION("Test vkCmdDecompressMemoryIndirectCountNV with fewer commands than dispatched workgroups.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState()) {
+        GTEST_SKIP() << kSkipPrefix << " decompression not supported, skipping test";
+    }
+    VkResult result = VK_SUCCESS;
+
+    VkConstantBufferObj srcBuffer1(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer1.initialized());
+
+    VkConstantBufferObj srcBuffer2(m_device, COMPRESSED_SIZE2, compressedData2, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer2.initialized());
+
+    // The layer always dispatches a fixed grid for the indirect path, so the grid is larger than the command count and
+    // the command table holds valid commands past the count that must not be executed
+    const uint32_t tableSize = 3;
+    std::vector<uint8_t> decompressData(tableSize * DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, tableSize * DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    VkBufferDeviceAddressInfo srcBufferAddr1 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer1.handle()};
+    VkBufferDeviceAddressInfo srcBufferAddr2 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer2.handle()};
+    VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+
+    VkDecompressMemoryRegionNV regions[tableSize];
+    for (uint32_t i = 0; i < tableSize; ++i) {
+        regions[i].compressedSize = (i % 2) ? COMPRESSED_SIZE2 : COMPRESSED_SIZE1;
+        regions[i].decompressedSize = DECOMPRESSED_SIZE;
+        regions[i].srcAddress = vkGetBufferDeviceAddress(m_device->device(), (i % 2) ? &srcBufferAddr2 : &srcBufferAddr1);
+        regions[i].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr) + i * DECOMPRESSED_SIZE_ALIGNED;
+        regions[i].decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV;
+    }
+
+    const uint32_t count = 1;
+    VkConstantBufferObj indirectBufferCount(m_device, sizeof(uint32_t), &count, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(indirectBufferCount.initialized());
+    VkConstantBufferObj indirectBufferDecompress(m_device, tableSize * sizeof(VkDecompressMemoryRegionNV), &regions[0],
+                                                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(indirectBufferDecompress.initialized());
+
+    VkBufferDeviceAddressInfo indirectCountAddrInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr,
+                                                       indirectBufferCount.handle()};
+    VkDeviceAddress indirectCountAddr = vkGetBufferDeviceAddress(m_device->device(), &indirectCountAddrInfo);
+    ASSERT_TRUE(indirectCountAddr != 0);
+
+    VkBufferDeviceAddressInfo decompressParamAddrInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr,
+                                                         indirectBufferDecompress.handle()};
+    VkDeviceAddress decompressParamAddr = vkGetBufferDeviceAddress(m_device->device(), &decompressParamAddrInfo);
+    ASSERT_TRUE(decompressParamAddr != 0);
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdDecompressMemoryIndirectCountNV(command_buffer, decompressParamAddr, indirectCountAddr,
+                                               sizeof(VkDecompressMemoryRegionNV));
+        vkEndCommandBuffer(command_buffer);
+    }
+    {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vkQueueWaitIdle(queue);
+    {
+        uint8_t *decompressedDataResult = static_cast<uint8_t *>(dstBuffer.memory().map());
+        ASSERT_TRUE(memcmp(decompressedDataResult, decompressedData, DECOMPRESSED_SIZE) == 0);
+        // Nothing past the command count may be written, including the padding after the last executed region
+        ASSERT_TRUE(std::all_of(decompressedDataResult + DECOMPRESSED_SIZE,
+                                decompressedDataResult + tableSize * DECOMPRESSED_SIZE_ALIGNED,
+                                [](uint8_t value) { return value == 0xFF; }));
+        dstBuffer.memory().unmap();
+    }
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+}
+
+TEST_F(DecompressionTest, DecompressMemoryEXT) {
+    TEST_DESCRIPTION("Test vkCmdDecompressMemoryEXT.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState() || !DeviceExtensionEnabled(VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME)) {
+        GTEST_SKIP() << kSkipPrefix << " VK_EXT_memory_decompression not supported, skipping test";
+    }
+    VkResult result = VK_SUCCESS;
+
+    VkConstantBufferObj srcBuffer1(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer1.initialized());
+
+    VkConstantBufferObj srcBuffer2(m_device, COMPRESSED_SIZE2, compressedData2, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer2.initialized());
+
+    std::vector<uint8_t> decompressData(2 * DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, 2 * DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    VkBufferDeviceAddressInfo srcBufferAddr1 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer1.handle()};
+    VkBufferDeviceAddressInfo srcBufferAddr2 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer2.handle()};
+    VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+
+    VkDecompressMemoryRegionEXT regions[2] = {};
+    regions[0].srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr1);
+    regions[0].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr);
+    regions[0].compressedSize = COMPRESSED_SIZE1;
+    regions[0].decompressedSize = DECOMPRESSED_SIZE;
+    regions[1].srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr2);
+    regions[1].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr) + DECOMPRESSED_SIZE_ALIGNED;
+    regions[1].compressedSize = COMPRESSED_SIZE2;
+    regions[1].decompressedSize = DECOMPRESSED_SIZE;
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        auto decompress_info = vku::InitStruct<VkDecompressMemoryInfoEXT>();
+        decompress_info.decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT;
+        decompress_info.regionCount = 2;
+        decompress_info.pRegions = &regions[0];
+
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdDecompressMemoryEXT(command_buffer, &decompress_info);
+        vkEndCommandBuffer(command_buffer);
+    }
+    {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vkQueueWaitIdle(queue);
+    {
+        void *decompressedDataResult = dstBuffer.memory().map();
+        int compareResult = memcmp(decompressedDataResult, decompressedData, DECOMPRESSED_SIZE);
+        compareResult |= memcmp((uint8_t *)decompressedDataResult + DECOMPRESSED_SIZE_ALIGNED, decompressedData, DECOMPRESSED_SIZE);
+        ASSERT_TRUE(compareResult == 0);
+        dstBuffer.memory().unmap();
+    }
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+}
+
+TEST_F(DecompressionTest, DecompressMemoryIndirectEXT) {
+    TEST_DESCRIPTION("Test vkCmdDecompressMemoryIndirectCountEXT, with a count above maxDecompressionCount.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState() || !DeviceExtensionEnabled(VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME)) {
+        GTEST_SKIP() << kSkipPrefix << " VK_EXT_memory_decompression not supported, skipping test";
+    }
+    VkResult result = VK_SUCCESS;
+
+    VkConstantBufferObj srcBuffer1(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer1.initialized());
+
+    VkConstantBufferObj srcBuffer2(m_device, COMPRESSED_SIZE2, compressedData2, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer2.initialized());
+
+    std::vector<uint8_t> decompressData(3 * DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, 3 * DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    VkBufferDeviceAddressInfo srcBufferAddr1 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer1.handle()};
+    VkBufferDeviceAddressInfo srcBufferAddr2 = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer2.handle()};
+    VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+
+    // The third command is past maxDecompressionCount and must leave its part of the destination untouched
+    const uint32_t count = 3;
+    const uint32_t maxDecompressionCount = 2;
+    VkDecompressMemoryRegionEXT regions[count];
+    for (uint32_t i = 0; i < count; i++) {
+        regions[i].srcAddress = vkGetBufferDeviceAddress(m_device->device(), i == 1 ? &srcBufferAddr2 : &srcBufferAddr1);
+        regions[i].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr) + i * DECOMPRESSED_SIZE_ALIGNED;
+        regions[i].compressedSize = i == 1 ? COMPRESSED_SIZE2 : COMPRESSED_SIZE1;
+        regions[i].decompressedSize = DECOMPRESSED_SIZE;
+    }
+
+    VkConstantBufferObj indirectBufferCount(m_device, sizeof(uint32_t), &count, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(indirectBufferCount.initialized());
+    VkConstantBufferObj indirectBufferDecompress(m_device, count * sizeof(VkDecompressMemoryRegionEXT), &regions[0],
+                                                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(indirectBufferDecompress.initialized());
+
+    VkBufferDeviceAddressInfo indirectCountAddrInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr,
+                                                       indirectBufferCount.handle()};
+    VkDeviceAddress indirectCountAddr = vkGetBufferDeviceAddress(m_device->device(), &indirectCountAddrInfo);
+    ASSERT_TRUE(indirectCountAddr != 0);
+
+    VkBufferDeviceAddressInfo decompressParamAddrInfo = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr,
+                                                         indirectBufferDecompress.handle()};
+    VkDeviceAddress decompressParamAddr = vkGetBufferDeviceAddress(m_device->device(), &decompressParamAddrInfo);
+    ASSERT_TRUE(decompressParamAddr != 0);
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdDecompressMemoryIndirectCountEXT(command_buffer, VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT,
+                                              decompressParamAddr, indirectCountAddr, maxDecompressionCount,
+                                              sizeof(VkDecompressMemoryRegionEXT));
+        vkEndCommandBuffer(command_buffer);
+    }
+    {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vkQueueWaitIdle(queue);
+    {
+        uint8_t *decompressedDataResult = static_cast<uint8_t *>(dstBuffer.memory().map());
+        int compareResult = memcmp(decompressedDataResult, decompressedData, DECOMPRESSED_SIZE);
+        compareResult |= memcmp(decompressedDataResult + DECOMPRESSED_SIZE_ALIGNED, decompressedData, DECOMPRESSED_SIZE);
+        ASSERT_TRUE(compareResult == 0);
+        const uint8_t *skipped = decompressedDataResult + 2 * DECOMPRESSED_SIZE_ALIGNED;
+        ASSERT_TRUE(std::all_of(skipped, skipped + DECOMPRESSED_SIZE, [](uint8_t value) { return value == 0xFF; }));
+        dstBuffer.memory().unmap();
+    }
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+}
+
+TEST_F(DecompressionTest, DecompressionStatistics) {
+    TEST_DESCRIPTION("Test the statistics of the instrumentation setting.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState()) {
+        GTEST_SKIP() << kSkipPrefix << " decompression not supported, skipping test";
+    }
+
+    auto vkGetMemoryDecompressionStatisticsKHRONOS = reinterpret_cast<PFN_vkGetMemoryDecompressionStatisticsKHRONOS>(
+        vkGetDeviceProcAddr(m_device->device(), "vkGetMemoryDecompressionStatisticsKHRONOS"));
+    ASSERT_TRUE(vkGetMemoryDecompressionStatisticsKHRONOS != nullptr);
+    VkMemoryDecompressionStatisticsKHRONOS before = {};
+    if (vkGetMemoryDecompressionStatisticsKHRONOS(m_device->device(), &before) != VK_SUCCESS) {
+        GTEST_SKIP() << kSkipPrefix << " instrumentation not supported, skipping test";
+    }
+    VkResult result = VK_SUCCESS;
+
+    VkConstantBufferObj srcBuffer(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer.initialized());
+
+    std::vector<uint8_t> decompressData(2 * DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, 2 * DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    VkBufferDeviceAddressInfo srcBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer.handle()};
+    VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+
+    VkDecompressMemoryRegionNV regions[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        regions[i].srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr);
+        regions[i].dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr) + i * DECOMPRESSED_SIZE_ALIGNED;
+        regions[i].compressedSize = COMPRESSED_SIZE1;
+        regions[i].decompressedSize = DECOMPRESSED_SIZE;
+        regions[i].decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV;
+    }
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdDecompressMemoryNV(command_buffer, 2, &regions[0]);
+        vkEndCommandBuffer(command_buffer);
+    }
+    // Submitting the command buffer again writes its timestamp queries again
+    for (uint32_t submission = 0; submission < 2; submission++) {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+        vkQueueWaitIdle(queue);
+    }
+
+    // The timestamps are read back when the command buffer is reset, and count the last submission
+    vkResetCommandBuffer(command_buffer, 0);
+    VkMemoryDecompressionStatisticsKHRONOS after = {};
+    ASSERT_EQ(vkGetMemoryDecompressionStatisticsKHRONOS(m_device->device(), &after), VK_SUCCESS);
+    ASSERT_EQ(after.dispatchCount - before.dispatchCount, 1u);
+    ASSERT_EQ(after.regionCount - before.regionCount, 2u);
+    ASSERT_EQ(after.compressedBytes - before.compressedBytes, 2u * COMPRESSED_SIZE1);
+    ASSERT_EQ(after.decompressedBytes - before.decompressedBytes, 2u * DECOMPRESSED_SIZE);
+    ASSERT_GT(after.gpuNanoseconds, before.gpuNanoseconds);
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+}
+
+TEST_F(DecompressionTest, DecompressMemoryRestoresComputeState) {
+    TEST_DESCRIPTION("Test that the app's compute pipeline and push constants are restored after vkCmdDecompressMemoryNV.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState()) {
+        GTEST_SKIP() << kSkipPrefix << " decompression not supported, skipping test";
+    }
+    VkResult result = VK_SUCCESS;
+
+    static const char compSource[] = R"glsl(
+        #version 450
+        #extension GL_EXT_buffer_reference : require
+        layout(local_size_x = 1) in;
+        layout(buffer_reference) buffer Output {
+            uint value;
+        };
+        layout(push_constant) uniform PushConstants {
+            Output dst;
+            uint value;
+        };
+
+        void main() {
+            dst.value = value;
+        }
+    )glsl";
+    std::vector<unsigned int> spv;
+    ASSERT_TRUE(GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_COMPUTE_BIT, compSource, spv, false, 5));
+
+    VkShaderModule shader_module;
+    auto module_create_info = vku::InitStruct<VkShaderModuleCreateInfo>();
+    module_create_info.codeSize = spv.size() * sizeof(unsigned int);
+    module_create_info.pCode = spv.data();
+    result = vkCreateShaderModule(m_device->device(), &module_create_info, nullptr, &shader_module);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, 16};
+    VkPipelineLayout pipeline_layout;
+    auto layout_create_info = vku::InitStruct<VkPipelineLayoutCreateInfo>();
+    layout_create_info.pushConstantRangeCount = 1;
+    layout_create_info.pPushConstantRanges = &push_constant_range;
+    result = vkCreatePipelineLayout(m_device->device(), &layout_create_info, nullptr, &pipeline_layout);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    // Constants pushed through a layout with identical push constant ranges stay valid
+    VkPipelineLayout compatible_layout;
+    result = vkCreatePipelineLayout(m_device->device(), &layout_create_info, nullptr, &compatible_layout);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkPipeline pipeline;
+    auto pipeline_create_info = vku::InitStruct<VkComputePipelineCreateInfo>();
+    pipeline_create_info.stage = vku::InitStruct<VkPipelineShaderStageCreateInfo>();
+    pipeline_create_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_create_info.stage.module = shader_module;
+    pipeline_create_info.stage.pName = "main";
+    pipeline_create_info.layout = pipeline_layout;
+    result = vkCreateComputePipelines(m_device->device(), VK_NULL_HANDLE, 1, &pipeline_create_info, nullptr, &pipeline);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkConstantBufferObj srcBuffer(m_device, COMPRESSED_SIZE1, compressedData1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(srcBuffer.initialized());
+
+    std::vector<uint8_t> decompressData(DECOMPRESSED_SIZE_ALIGNED, 0xFF);
+    VkConstantBufferObj dstBuffer(m_device, DECOMPRESSED_SIZE_ALIGNED, decompressData.data(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(dstBuffer.initialized());
+
+    const uint32_t outputData = 0;
+    VkConstantBufferObj outputBuffer(m_device, sizeof(outputData), &outputData, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+    ASSERT_TRUE(outputBuffer.initialized());
+
+    VkBufferDeviceAddressInfo srcBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, srcBuffer.handle()};
+    VkBufferDeviceAddressInfo dstBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, dstBuffer.handle()};
+    VkBufferDeviceAddressInfo outputBufferAddr = {VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, outputBuffer.handle()};
+
+    VkDecompressMemoryRegionNV region = {};
+    region.srcAddress = vkGetBufferDeviceAddress(m_device->device(), &srcBufferAddr);
+    region.dstAddress = vkGetBufferDeviceAddress(m_device->device(), &dstBufferAddr);
+    region.compressedSize = COMPRESSED_SIZE1;
+    region.decompressedSize = DECOMPRESSED_SIZE;
+    region.decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_NV;
+
+    struct {
+        VkDeviceAddress dst;
+        uint32_t value;
+        uint32_t padding;
+    } pushConstants = {vkGetBufferDeviceAddress(m_device->device(), &outputBufferAddr), 42, 0};
+
+    VkCommandPool command_pool;
+    auto pool_create_info = vku::InitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    result = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &command_pool);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkCommandBuffer command_buffer;
+    auto command_buffer_allocate_info = vku::InitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffer);
+    ASSERT_TRUE(result == VK_SUCCESS);
+
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 0, &queue);
+
+    {
+        auto begin_info = vku::InitStruct<VkCommandBufferBeginInfo>();
+        vkBeginCommandBuffer(command_buffer, &begin_info);
+        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vkCmdPushConstants(command_buffer, pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(pushConstants.dst),
+                           &pushConstants.dst);
+        vkCmdPushConstants(command_buffer, compatible_layout, VK_SHADER_STAGE_COMPUTE_BIT, sizeof(pushConstants.dst),
+                           sizeof(pushConstants) - sizeof(pushConstants.dst), &pushConstants.value);
+        vkCmdDecompressMemoryNV(command_buffer, 1, &region);
+
+        // The barrier records the decompression, the dispatch after it relies on the state set before
+        auto memory_barrier = vku::InitStruct<VkMemoryBarrier>();
+        memory_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        memory_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                             &memory_barrier, 0, nullptr, 0, nullptr);
+        vkCmdDispatch(command_buffer, 1, 1, 1);
+        vkEndCommandBuffer(command_buffer);
+    }
+    {
+        auto submit_info = vku::InitStruct<VkSubmitInfo>();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+    }
+    vkQueueWaitIdle(queue);
+    {
+        void *decompressedDataResult = dstBuffer.memory().map();
+        ASSERT_TRUE(memcmp(decompressedDataResult, decompressedData, DECOMPRESSED_SIZE) == 0);
+        dstBuffer.memory().unmap();
+
+        void *outputResult = outputBuffer.memory().map();
+        ASSERT_EQ(*static_cast<uint32_t *>(outputResult), 42u);
+        outputBuffer.memory().unmap();
+    }
+
+    vkFreeCommandBuffers(m_device->device(), command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(m_device->device(), command_pool, NULL);
+    vkDestroyPipeline(m_device->device(), pipeline, nullptr);
+    vkDestroyPipelineLayout(m_device->device(), compatible_layout, nullptr);
+    vkDestroyPipelineLayout(m_device->device(), pipeline_layout, nullptr);
+    vkDestroyShaderModule(m_device->device(), shader_module, nullptr);
+}
+
+TEST_F(DecompressionTest, DecompressMemoryHost) {
+    TEST_DESCRIPTION("Test decompressing regions in host memory through the layer's own entry point.");
+
+    if (InstanceExtensionSupported(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        GTEST_SKIP() << "VK_KHR_portability_subset enabled, skipping.\n";
+    }
+
+    if (!CheckDecompressionSupportAndInitState()) {
+        GTEST_SKIP() << kSkipPrefix << " decompression not supported, skipping test";
+    }
+
+    auto vkDecompressMemoryHostKHRONOS = reinterpret_cast<PFN_vkDecompressMemoryHostKHRONOS>(
+        vkGetDeviceProcAddr(m_device->device(), "vkDecompressMemoryHostKHRONOS"));
+    ASSERT_TRUE(vkDecompressMemoryHostKHRONOS != nullptr);
+
+    std::vector<uint8_t> decompressData(2 * DECOMPRESSED_SIZE, 0xFF);
+    const uint8_t* compressedData[2] = {compressedData1, compressedData2};
+    const uint32_t compressedSize[2] = {COMPRESSED_SIZE1, COMPRESSED_SIZE2};
+    VkDecompressMemoryRegionHostKHRONOS regions[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        regions[i].pSrc = compressedData[i];
+        regions[i].pDst = decompressData.data() + i * DECOMPRESSED_SIZE;
+        regions[i].compressedSize = compressedSize[i];
+        regions[i].decompressedSize = DECOMPRESSED_SIZE;
+        regions[i].decompressionMethod = VK_MEMORY_DECOMPRESSION_METHOD_GDEFLATE_1_0_BIT_EXT;
+    }
+    ASSERT_EQ(vkDecompressMemoryHostKHRONOS(m_device->device(), 2, regions), VK_SUCCESS);
+    for (uint32_t i = 0; i < 2; i++) {
+        ASSERT_EQ(memcmp(decompressData.data() + i * DECOMPRESSED_SIZE, decompressedData, DECOMPRESSED_SIZE), 0);
+    }
+
+    // A truncated tile is reported instead of decompressed
+    regions[1].compressedSize = COMPRESSED_SIZE2 / 2;
+    ASSERT_EQ(vkDecompressMemoryHostKHRONOS(m_device->device(), 2, regions), VK_ERROR_UNKNOWN);
+}
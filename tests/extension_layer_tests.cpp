@@ -208,6 +208,10 @@ bool VkExtensionLayerTest::CheckDecompressionSupportAndInitState() {
         decompressionExtensionFound = true;
         m_device_extension_names.push_back(VK_NV_MEMORY_DECOMPRESSION_EXTENSION_NAME);
     }
+    if (DeviceExtensionSupported(VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME, 1)) {
+        decompressionExtensionFound = true;
+        m_device_extension_names.push_back(VK_EXT_MEMORY_DECOMPRESSION_EXTENSION_NAME);
+    }
 
     auto decompress_features = vku::InitStruct<VkPhysicalDeviceMemoryDecompressionFeaturesNV>();
     auto features2 = vku::InitStruct<VkPhysicalDeviceFeatures2KHR>(&decompress_features);
@@ -0,0 +1,265 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gdeflate.h"
+#include "decompression_data.h"
+#include "shaders/spirv/GInflate_vk.h"
+
+// Wraps a single tile in a GDeflate stream header
+static std::vector<uint8_t> MakeStream(const uint8_t* tile, uint32_t tile_size, uint32_t decompressed_size) {
+    const uint32_t header[3] = {gdeflate::kStreamId | (gdeflate::kStreamMagic << 8) | (1u << 16), decompressed_size << 2,
+                                tile_size};
+    std::vector<uint8_t> stream(sizeof(header) + tile_size);
+    memcpy(stream.data(), header, sizeof(header));
+    memcpy(stream.data() + sizeof(header), tile, tile_size);
+    return stream;
+}
+
+// Decompresses the SPIR-V of an embedded shader variant
+static std::vector<uint32_t> EmbeddedShader(const gdeflate::EmbeddedStream& stream) {
+    std::vector<uint32_t> code(stream.decompressed_size / sizeof(uint32_t));
+    if (!gdeflate::DecompressStream(kGInflateSpirvData + stream.offset, stream.size, reinterpret_cast<uint8_t*>(code.data()),
+                                    stream.decompressed_size, 1)) {
+        code.clear();
+    }
+    return code;
+}
+
+// Calls visit with the opcode and the operands of every instruction of a SPIR-V module
+template <typename Visit>
+static void ForEachInstruction(const std::vector<uint32_t>& code, Visit&& visit) {
+    static constexpr size_t kHeaderSize = 5;
+    for (size_t i = kHeaderSize; i < code.size() && (code[i] >> 16) != 0;) {
+        const size_t word_count = std::min<size_t>(code[i] >> 16, code.size() - i);
+        visit(code[i] & 0xFFFF, &code[i + 1], word_count - 1);
+        i += word_count;
+    }
+}
+
+// Returns the ids of the specialization constants a SPIR-V module declares
+static std::vector<uint32_t> SpecIds(const std::vector<uint32_t>& code) {
+    static constexpr uint32_t kOpDecorate = 71;
+    static constexpr uint32_t kDecorationSpecId = 1;
+    std::vector<uint32_t> spec_ids;
+    ForEachInstruction(code, [&](uint32_t opcode, const uint32_t* operands, size_t operand_count) {
+        if (opcode == kOpDecorate && operand_count == 3 && operands[1] == kDecorationSpecId) {
+            spec_ids.push_back(operands[2]);
+        }
+    });
+    return spec_ids;
+}
+
+// Returns the member offsets of the push constant block of a SPIR-V module
+static std::vector<uint32_t> PushConstantOffsets(const std::vector<uint32_t>& code) {
+    static constexpr uint32_t kOpTypePointer = 32;
+    static constexpr uint32_t kOpVariable = 59;
+    static constexpr uint32_t kOpMemberDecorate = 72;
+    static constexpr uint32_t kStorageClassPushConstant = 9;
+    static constexpr uint32_t kDecorationOffset = 35;
+    std::vector<std::pair<uint32_t, uint32_t>> pointee_types;
+    std::vector<std::pair<uint32_t, uint32_t>> member_offsets;
+    uint32_t block_pointer = 0;
+    ForEachInstruction(code, [&](uint32_t opcode, const uint32_t* operands, size_t operand_count) {
+        if (opcode == kOpTypePointer && operand_count == 3) {
+            pointee_types.emplace_back(operands[0], operands[2]);
+        } else if (opcode == kOpVariable && operand_count >= 3 && operands[2] == kStorageClassPushConstant) {
+            block_pointer = operands[0];
+        } else if (opcode == kOpMemberDecorate && operand_count == 4 && operands[2] == kDecorationOffset) {
+            member_offsets.emplace_back(operands[0], operands[3]);
+        }
+    });
+    std::vector<uint32_t> offsets;
+    for (const auto& pointer : pointee_types) {
+        if (pointer.first == block_pointer) {
+            for (const auto& member : member_offsets) {
+                if (member.first == pointer.second) {
+                    offsets.push_back(member.second);
+                }
+            }
+        }
+    }
+    return offsets;
+}
+
+TEST(GDeflateTest, DecompressTile) {
+    const uint8_t* tiles[] = {compressedData1, compressedData2};
+    const size_t sizes[] = {COMPRESSED_SIZE1, COMPRESSED_SIZE2};
+
+    for (size_t i = 0; i < std::size(tiles); ++i) {
+        std::vector<uint8_t> dst(DECOMPRESSED_SIZE, 0xFF);
+        size_t decompressed_size = 0;
+        ASSERT_TRUE(gdeflate::DecompressTile(tiles[i], sizes[i], dst.data(), dst.size(), &decompressed_size));
+        ASSERT_EQ(decompressed_size, static_cast<size_t>(DECOMPRESSED_SIZE));
+        ASSERT_EQ(memcmp(dst.data(), decompressedData, DECOMPRESSED_SIZE), 0);
+    }
+}
+
+TEST(GDeflateTest, DecompressStream) {
+    const std::vector<uint8_t> stream = MakeStream(compressedData1, COMPRESSED_SIZE1, DECOMPRESSED_SIZE);
+
+    gdeflate::StreamInfo info;
+    ASSERT_TRUE(gdeflate::GetStreamInfo(stream.data(), stream.size(), &info));
+    ASSERT_EQ(info.num_tiles, 1u);
+    ASSERT_EQ(info.decompressed_size, static_cast<size_t>(DECOMPRESSED_SIZE));
+
+    for (uint32_t num_threads = 0; num_threads < 3; ++num_threads) {
+        std::vector<uint8_t> dst(DECOMPRESSED_SIZE, 0xFF);
+        ASSERT_TRUE(gdeflate::DecompressStream(stream.data(), stream.size(), dst.data(), dst.size(), num_threads));
+        ASSERT_EQ(memcmp(dst.data(), decompressedData, DECOMPRESSED_SIZE), 0);
+    }
+}
+
+TEST(GDeflateTest, MalformedInput) {
+    std::vector<uint8_t> dst(DECOMPRESSED_SIZE);
+    size_t decompressed_size = 0;
+
+    // Output does not fit
+    ASSERT_FALSE(gdeflate::DecompressTile(compressedData1, COMPRESSED_SIZE1, dst.data(), DECOMPRESSED_SIZE - 1, &decompressed_size));
+
+    // Truncated tile
+    ASSERT_FALSE(gdeflate::DecompressTile(compressedData1, COMPRESSED_SIZE1 / 2, dst.data(), dst.size(), &decompressed_size));
+
+    // Bad stream magic and tile offsets past the end of the stream
+    std::vector<uint8_t> stream = MakeStream(compressedData1, COMPRESSED_SIZE1, DECOMPRESSED_SIZE);
+    stream[1] = 0;
+    ASSERT_FALSE(gdeflate::DecompressStream(stream.data(), stream.size(), dst.data(), dst.size()));
+    stream = MakeStream(compressedData1, COMPRESSED_SIZE1, DECOMPRESSED_SIZE);
+    stream.resize(stream.size() - 1);
+    ASSERT_FALSE(gdeflate::DecompressStream(stream.data(), stream.size(), dst.data(), dst.size()));
+}
+
+TEST(GDeflateTest, CompressRoundTrip) {
+    const gdeflate::Corpus corpora[] = {gdeflate::Corpus::kText, gdeflate::Corpus::kTexture, gdeflate::Corpus::kMesh,
+                                        gdeflate::Corpus::kRandom, gdeflate::Corpus::kIncompressible};
+    const size_t sizes[] = {1, 1000, gdeflate::kTileSize, 3 * gdeflate::kTileSize + 12345};
+
+    for (const gdeflate::Corpus corpus : corpora) {
+        for (const size_t size : sizes) {
+            std::vector<uint8_t> data;
+            gdeflate::GenerateCorpus(corpus, size, 1, &data);
+
+            for (const uint32_t level : {gdeflate::kMinLevel, 1u, gdeflate::kDefaultLevel, gdeflate::kMaxLevel}) {
+                std::vector<uint8_t> stream;
+                std::vector<gdeflate::TileRegion> regions;
+                ASSERT_TRUE(gdeflate::CompressStream(data.data(), data.size(), level, &stream, &regions, 2));
+
+                std::vector<uint8_t> decompressed(size);
+                ASSERT_TRUE(gdeflate::DecompressStream(stream.data(), stream.size(), decompressed.data(), decompressed.size()));
+                ASSERT_EQ(decompressed, data) << gdeflate::CorpusName(corpus) << " " << size << " level " << level;
+
+                // Regions locate the raw tiles in the stream
+                ASSERT_EQ(regions.size(), (size + gdeflate::kTileSize - 1) / gdeflate::kTileSize);
+                for (const gdeflate::TileRegion& region : regions) {
+                    ASSERT_EQ(region.src_offset % 4, 0u);
+                    std::vector<uint8_t> tile(region.decompressed_size);
+                    size_t decompressed_size = 0;
+                    ASSERT_TRUE(gdeflate::DecompressTile(stream.data() + region.src_offset, region.compressed_size, tile.data(),
+                                                         tile.size(), &decompressed_size));
+                    ASSERT_EQ(decompressed_size, region.decompressed_size);
+                    ASSERT_EQ(memcmp(tile.data(), data.data() + region.dst_offset, decompressed_size), 0);
+                }
+            }
+        }
+    }
+}
+
+TEST(GDeflateTest, DecompressRegions) {
+    // Streams of different lengths, so that some threads run out of their own tiles
+    const size_t sizes[] = {1000, 5 * gdeflate::kTileSize + 77, gdeflate::kTileSize, 2 * gdeflate::kTileSize};
+    std::vector<std::vector<uint8_t>> data(std::size(sizes));
+    std::vector<std::vector<uint8_t>> streams(std::size(sizes));
+    std::vector<std::vector<uint8_t>> decompressed(std::size(sizes));
+    std::vector<gdeflate::HostRegion> stream_regions;
+    std::vector<gdeflate::HostRegion> tile_regions;
+    std::vector<std::vector<gdeflate::TileRegion>> tiles(std::size(sizes));
+    for (size_t i = 0; i < std::size(sizes); ++i) {
+        gdeflate::GenerateCorpus(gdeflate::Corpus::kMesh, sizes[i], static_cast<uint32_t>(i), &data[i]);
+        ASSERT_TRUE(gdeflate::CompressStream(data[i].data(), data[i].size(), gdeflate::kDefaultLevel, &streams[i], &tiles[i]));
+        decompressed[i].resize(sizes[i]);
+        stream_regions.push_back({streams[i].data(), streams[i].size(), decompressed[i].data(), decompressed[i].size()});
+    }
+    for (size_t i = 0; i < std::size(sizes); ++i) {
+        for (const gdeflate::TileRegion& tile : tiles[i]) {
+            tile_regions.push_back({streams[i].data() + tile.src_offset, tile.compressed_size,
+                                    decompressed[i].data() + tile.dst_offset, tile.decompressed_size});
+        }
+    }
+
+    for (uint32_t num_threads = 0; num_threads < 3; ++num_threads) {
+        for (const bool stream_format : {true, false}) {
+            for (auto& output : decompressed) {
+                std::fill(output.begin(), output.end(), uint8_t(0xFF));
+            }
+            const std::vector<gdeflate::HostRegion>& regions = stream_format ? stream_regions : tile_regions;
+            ASSERT_TRUE(gdeflate::DecompressRegions(regions.data(), regions.size(), stream_format, num_threads));
+            ASSERT_EQ(decompressed, data);
+        }
+    }
+
+    // The decompressed size must match exactly
+    stream_regions[0].dst_size -= 1;
+    ASSERT_FALSE(gdeflate::DecompressRegions(stream_regions.data(), stream_regions.size(), true));
+    tile_regions[0].dst_size += 1;
+    ASSERT_FALSE(gdeflate::DecompressRegions(tile_regions.data(), tile_regions.size(), false));
+}
+
+TEST(GDeflateTest, EmbeddedShaders) {
+    // Every shader variant the memory decompression layer embeds decompresses to a SPIR-V module
+    for (const gdeflate::EmbeddedStream& stream : kGInflateSpirv) {
+        ASSERT_LE(stream.offset + stream.size, sizeof(kGInflateSpirvData));
+        ASSERT_EQ(stream.decompressed_size % sizeof(uint32_t), 0u);
+        std::vector<uint32_t> code(stream.decompressed_size / sizeof(uint32_t));
+        ASSERT_TRUE(gdeflate::DecompressStream(kGInflateSpirvData + stream.offset, stream.size,
+                                               reinterpret_cast<uint8_t*>(code.data()), stream.decompressed_size, 1));
+        ASSERT_EQ(code[0], 0x07230203u);
+    }
+}
+
+TEST(GDeflateTest, EmbeddedShaderSpecialization) {
+    // The layer selects whole GDeflate streams with specialization constant 0 of the indirect variants, which follow the
+    // 16 direct ones, and sizes the Huffman lookup tables of every variant with constant 1. Specializing a constant the
+    // module does not declare is silently ignored.
+    const size_t kDirectVariantCount = 16;
+    ASSERT_EQ(std::size(kGInflateSpirv), 2 * kDirectVariantCount);
+    for (size_t i = 0; i < std::size(kGInflateSpirv); ++i) {
+        const std::vector<uint32_t> code = EmbeddedShader(kGInflateSpirv[i]);
+        ASSERT_FALSE(code.empty());
+        const std::vector<uint32_t> spec_ids = SpecIds(code);
+        ASSERT_EQ(std::count(spec_ids.begin(), spec_ids.end(), 0u), i < kDirectVariantCount ? 0 : 1) << "variant " << i;
+        ASSERT_EQ(std::count(spec_ids.begin(), spec_ids.end(), 1u), 1) << "variant " << i;
+    }
+}
+
+TEST(GDeflateTest, EmbeddedShaderPushConstants) {
+    // The direct variants read a VkDecompressMemoryRegionEXT from push constants and the indirect ones the layer's
+    // PushConstantDataDecompressMulti: command address, stride, maximum count and count address
+    const std::vector<uint32_t> region_offsets = {0, 8, 16, 24};
+    const std::vector<uint32_t> multi_offsets = {0, 8, 12, 16};
+    const size_t kDirectVariantCount = 16;
+    for (size_t i = 0; i < std::size(kGInflateSpirv); ++i) {
+        const std::vector<uint32_t> code = EmbeddedShader(kGInflateSpirv[i]);
+        ASSERT_FALSE(code.empty());
+        ASSERT_EQ(PushConstantOffsets(code), i < kDirectVariantCount ? region_offsets : multi_offsets) << "variant " << i;
+    }
+}
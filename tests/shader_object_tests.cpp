@@ -17,16 +17,27 @@
  */
 
 #include <type_traits>
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <thread>
 
 #include "extension_layer_tests.h"
 #include "shader_object_tests.h"
 
 void ShaderObjectTest::SetUp() {
     VkBool32 force_enable = VK_TRUE;
+    const char* pipeline_cache_path = pipeline_cache_path_.c_str();
+    const char* draw_state_journal = draw_state_journal_.c_str();
 
     VkLayerSettingEXT settings[] = {
-        {"VK_LAYER_KHRONOS_shader_object", "force_enable", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &force_enable}};
+        {"VK_LAYER_KHRONOS_shader_object", "force_enable", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &force_enable},
+        {"VK_LAYER_KHRONOS_shader_object", "async_pipeline_compilation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+         &async_pipeline_compilation_},
+        {"VK_LAYER_KHRONOS_shader_object", "pipeline_cache_path", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &pipeline_cache_path},
+        {"VK_LAYER_KHRONOS_shader_object", "draw_state_journal", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &draw_state_journal}};
 
     VkLayerSettingsCreateInfoEXT layer_settings_create_info{VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
                                                             static_cast<uint32_t>(std::size(settings)), &settings[0]};
@@ -42,8 +53,10 @@ void ShaderObjectTest::SetUp() {
 
 void ShaderObjectTest::TearDown() {}
 
-void ShaderObjectTest::BindDefaultDynamicStates(VkBuffer buffer, bool tessellation) {
-    VkCommandBuffer cmdBuffer = m_commandBuffer->handle();
+void ShaderObjectTest::BindDefaultDynamicStates(VkBuffer buffer, bool tessellation, VkCommandBuffer cmdBuffer) {
+    if (cmdBuffer == VK_NULL_HANDLE) {
+        cmdBuffer = m_commandBuffer->handle();
+    }
     VkViewport viewport = {0, 0, m_width, m_height, 0.0f, 1.0f};
     VkRect2D scissor = {{
                             0,
@@ -116,6 +129,200 @@ void ShaderObjectTest::SubmitAndWait() {
     vkQueueWaitIdle(m_device->m_queue);
 }
 
+void ShaderObjectTest::RecreateDevice() {
+    delete m_commandBuffer;
+    m_commandBuffer = nullptr;
+    delete m_commandPool;
+    m_commandPool = nullptr;
+    delete m_depthStencil;
+    m_depthStencil = nullptr;
+    delete m_device;
+    m_device = nullptr;
+
+    m_device_extension_names.clear();
+    VkExtensionLayerTest::AddSwapchainDeviceExtension();
+    ASSERT_TRUE(CheckShaderObjectSupportAndInitState(false));
+}
+
+const float ShaderObjectTest::kQuadColor[4] = {0.2f, 0.4f, 0.6f, 0.8f};
+
+void ShaderObjectTest::CreateVertFragShaders(VkShaderEXT shaders[2], VkShaderCreateFlagsEXT flags, const char* vertSource,
+                                             const char* fragSource) {
+    static const char quadVertSource[] = R"glsl(
+        #version 460
+        void main() {
+            vec2 pos = vec2(float(gl_VertexIndex & 1), float((gl_VertexIndex >> 1) & 1));
+            gl_Position = vec4(pos - 0.5f, 0.0f, 1.0f);
+        }
+    )glsl";
+
+    static const char quadFragSource[] = R"glsl(
+        #version 460
+        layout(location = 0) out vec4 uFragColor;
+        void main(){
+           uFragColor = vec4(0.2f, 0.4f, 0.6f, 0.8f);
+        }
+    )glsl";
+
+    VkShaderStageFlagBits shaderStages[] = {VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT};
+
+    std::vector<unsigned int> spv[2];
+    GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_VERTEX_BIT, vertSource ? vertSource : quadVertSource, spv[0], false, 0);
+    GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_FRAGMENT_BIT, fragSource ? fragSource : quadFragSource, spv[1], false, 0);
+
+    VkShaderCreateInfoEXT createInfos[2];
+    for (uint32_t i = 0; i < 2; ++i) {
+        createInfos[i] = vku::InitStructHelper();
+        createInfos[i].flags = flags;
+        createInfos[i].stage = shaderStages[i];
+        if (i == 0) {
+            createInfos[i].nextStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        }
+        createInfos[i].codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        createInfos[i].codeSize = spv[i].size() * sizeof(unsigned int);
+        createInfos[i].pCode = spv[i].data();
+        createInfos[i].pName = "main";
+    }
+
+    ASSERT_EQ(vkCreateShadersEXT(m_device->handle(), 2u, createInfos, nullptr, shaders), VK_SUCCESS);
+}
+
+void ShaderObjectTest::InitColorImage(VkImageObj& image) {
+    VkImageCreateInfo imageInfo = vku::InitStructHelper();
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    imageInfo.extent = {static_cast<uint32_t>(m_width), static_cast<uint32_t>(m_height), 1};
+    imageInfo.mipLevels = 1u;
+    imageInfo.arrayLayers = 1u;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    image.init(&imageInfo);
+}
+
+void ShaderObjectTest::RecordQuad(VkCommandBuffer cmdBuffer, VkShaderEXT const shaders[2], VkImageObj& image,
+                                  VkBuffer vertexBuffer, VkBuffer colorBuffer, uint32_t drawCount,
+                                  uint32_t unusedAttachmentCount, std::function<void(VkCommandBuffer)> const& setState) {
+    VkShaderStageFlagBits shaderStages[] = {VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT};
+    VkShaderStageFlagBits unusedShaderStages[] = {VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+                                                  VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, VK_SHADER_STAGE_GEOMETRY_BIT};
+
+    std::vector<VkRenderingAttachmentInfo> color_attachments(1u + unusedAttachmentCount);
+    for (auto& color_attachment : color_attachments) {
+        color_attachment = vku::InitStructHelper();
+        color_attachment.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    }
+    color_attachments[0].imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    color_attachments[0].imageView = image.targetView(VK_FORMAT_R32G32B32A32_SFLOAT);
+    color_attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+
+    VkRenderingInfo begin_rendering_info = vku::InitStructHelper();
+    begin_rendering_info.renderArea.extent.width = static_cast<uint32_t>(m_width);
+    begin_rendering_info.renderArea.extent.height = static_cast<uint32_t>(m_height);
+    begin_rendering_info.layerCount = 1u;
+    begin_rendering_info.colorAttachmentCount = static_cast<uint32_t>(color_attachments.size());
+    begin_rendering_info.pColorAttachments = color_attachments.data();
+
+    VkImageMemoryBarrier imageMemoryBarrier = vku::InitStructHelper();
+    imageMemoryBarrier.srcAccessMask = VK_ACCESS_NONE;
+    imageMemoryBarrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    imageMemoryBarrier.image = image.handle();
+    imageMemoryBarrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u};
+    vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0u, 0u,
+                         nullptr, 0u, nullptr, 1u, &imageMemoryBarrier);
+
+    vkCmdBeginRenderingKHR(cmdBuffer, &begin_rendering_info);
+    vkCmdBindShadersEXT(cmdBuffer, 2u, shaderStages, shaders);
+    for (const auto& unusedShader : unusedShaderStages) {
+        VkShaderEXT null_shader = VK_NULL_HANDLE;
+        vkCmdBindShadersEXT(cmdBuffer, 1u, &unusedShader, &null_shader);
+    }
+    BindDefaultDynamicStates(vertexBuffer, false, cmdBuffer);
+    for (uint32_t i = 1; i < begin_rendering_info.colorAttachmentCount; ++i) {
+        VkBool32 colorBlendEnable = VK_FALSE;
+        vkCmdSetColorBlendEnableEXT(cmdBuffer, i, 1u, &colorBlendEnable);
+        VkColorBlendEquationEXT colorBlendEquation = {VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ONE, VK_BLEND_OP_ADD,
+                                                      VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ONE, VK_BLEND_OP_ADD};
+        vkCmdSetColorBlendEquationEXT(cmdBuffer, i, 1u, &colorBlendEquation);
+        VkColorComponentFlags colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        vkCmdSetColorWriteMaskEXT(cmdBuffer, i, 1u, &colorWriteMask);
+    }
+    if (setState) {
+        setState(cmdBuffer);
+    }
+    for (uint32_t i = 0; i < drawCount; ++i) {
+        vkCmdDraw(cmdBuffer, 4, 1, 0, 0);
+    }
+    vkCmdEndRenderingKHR(cmdBuffer);
+
+    imageMemoryBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0u, 0u,
+                         nullptr, 0u, nullptr, 1u, &imageMemoryBarrier);
+
+    VkBufferImageCopy copyRegion = {};
+    copyRegion.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u};
+    copyRegion.imageOffset.x = static_cast<int32_t>(m_width / 2) + 1;
+    copyRegion.imageOffset.y = static_cast<int32_t>(m_height / 2) + 1;
+    copyRegion.imageExtent = {1u, 1u, 1u};
+    vkCmdCopyImageToBuffer(cmdBuffer, image.handle(), VK_IMAGE_LAYOUT_GENERAL, colorBuffer, 1u, &copyRegion);
+}
+
+void ShaderObjectTest::CheckColor(VkBufferObj& colorBuffer, float const expected[4]) {
+    float* data;
+    vkMapMemory(m_device->handle(), colorBuffer.memory().handle(), 0u, sizeof(float) * 4u, 0u, (void**)&data);
+    float e = 0.01f;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (std::fabs(data[i] - expected[i]) > e) {
+            std::string msg = "Wrong pixel value " + std::to_string(data[i]) + ", expected " + std::to_string(expected[i]);
+            m_errorMonitor->SetError(msg.c_str());
+        }
+    }
+    vkUnmapMemory(m_device->handle(), colorBuffer.memory().handle());
+}
+
+void ShaderObjectTest::DrawQuad(VkShaderEXT const shaders[2], float const expected[4], uint32_t drawCount,
+                                std::function<void(VkCommandBuffer)> const& setState) {
+    VkBufferObj colorBuffer;
+    colorBuffer.init(*m_device, sizeof(float) * 4u, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                     VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkBufferObj vertexBuffer;
+    vertexBuffer.init(*m_device, sizeof(float), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+    VkImageObj image(m_device);
+    InitColorImage(image);
+
+    m_commandBuffer->begin();
+    RecordQuad(m_commandBuffer->handle(), shaders, image, vertexBuffer.handle(), colorBuffer.handle(), drawCount, 0u, setState);
+    m_commandBuffer->end();
+
+    SubmitAndWait();
+
+    CheckColor(colorBuffer, expected);
+}
+
+VkShaderObjectStatisticsKHRONOS ShaderObjectTest::GetStatistics() {
+    auto vkGetShaderObjectStatisticsKHRONOS = reinterpret_cast<PFN_vkGetShaderObjectStatisticsKHRONOS>(
+        vkGetDeviceProcAddr(m_device->handle(), "vkGetShaderObjectStatisticsKHRONOS"));
+    VkShaderObjectStatisticsKHRONOS statistics = {};
+    EXPECT_TRUE(vkGetShaderObjectStatisticsKHRONOS != nullptr);
+    if (vkGetShaderObjectStatisticsKHRONOS) {
+        vkGetShaderObjectStatisticsKHRONOS(m_device->handle(), &statistics);
+    }
+    return statistics;
+}
+
 TEST_F(ShaderObjectTest, VertFragShader) {
     TEST_DESCRIPTION("Test drawing with a vertex and fragment shader");
     SetTargetApiVersion(VK_API_VERSION_1_1);
@@ -293,6 +500,326 @@ TEST_F(ShaderObjectTest, VertFragShader) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(ShaderObjectTest, VertexInputAndBlendStates) {
+    TEST_DESCRIPTION("Test drawing the same shaders with different vertex input and color blend states");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    if (!CheckShaderObjectSupportAndInitState(false)) {
+        GTEST_SKIP() << kSkipPrefix << " shader object not supported, skipping test";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+
+    static const char vertSource[] = R"glsl(
+        #version 460
+        layout(location = 0) in vec2 inPos;
+        void main() {
+            gl_Position = vec4(inPos, 0.0f, 1.0f);
+        }
+    )glsl";
+
+    VkShaderEXT shaders[2];
+    CreateVertFragShaders(shaders, 0, vertSource);
+
+    // The quad positions, first tightly packed, then each after two unused floats
+    const float positions[4][2] = {{-0.5f, -0.5f}, {0.5f, -0.5f}, {-0.5f, 0.5f}, {0.5f, 0.5f}};
+    float vertexData[8 + 16] = {};
+    for (uint32_t i = 0; i < 4; ++i) {
+        vertexData[i * 2 + 0] = positions[i][0];
+        vertexData[i * 2 + 1] = positions[i][1];
+        vertexData[8 + i * 4 + 2] = positions[i][0];
+        vertexData[8 + i * 4 + 3] = positions[i][1];
+    }
+    VkBufferObj vertexBuffer;
+    vertexBuffer.init(*m_device, sizeof(vertexData), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    void* data;
+    vkMapMemory(m_device->handle(), vertexBuffer.memory().handle(), 0u, sizeof(vertexData), 0u, &data);
+    memcpy(data, vertexData, sizeof(vertexData));
+    vkUnmapMemory(m_device->handle(), vertexBuffer.memory().handle());
+
+    struct VertexLayout {
+        VkDeviceSize bufferOffset;
+        uint32_t stride;
+        uint32_t attributeOffset;
+    };
+    const VertexLayout vertexLayouts[2] = {{0u, 2u * sizeof(float), 0u}, {8u * sizeof(float), 4u * sizeof(float), 2u * sizeof(float)}};
+
+    // The second blend state halves the color with the blend constants
+    const float halfColor[4] = {kQuadColor[0] * 0.5f, kQuadColor[1] * 0.5f, kQuadColor[2] * 0.5f, kQuadColor[3] * 0.5f};
+    const VkBool32 blendEnables[2] = {VK_FALSE, VK_TRUE};
+
+    for (uint32_t pass = 0; pass < 2; ++pass) {
+        VkShaderObjectStatisticsKHRONOS before = GetStatistics();
+        for (const auto& vertexLayout : vertexLayouts) {
+            for (const auto& blendEnable : blendEnables) {
+                DrawQuad(shaders, blendEnable ? halfColor : kQuadColor, 1u, [&](VkCommandBuffer cmdBuffer) {
+                    VkBuffer buffer = vertexBuffer.handle();
+                    VkDeviceSize stride = vertexLayout.stride;
+                    vkCmdBindVertexBuffers2EXT(cmdBuffer, 0u, 1u, &buffer, &vertexLayout.bufferOffset, nullptr, &stride);
+
+                    VkVertexInputBindingDescription2EXT binding = vku::InitStructHelper();
+                    binding.binding = 0u;
+                    binding.stride = vertexLayout.stride;
+                    binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+                    binding.divisor = 1u;
+                    VkVertexInputAttributeDescription2EXT attribute = vku::InitStructHelper();
+                    attribute.location = 0u;
+                    attribute.binding = 0u;
+                    attribute.format = VK_FORMAT_R32G32_SFLOAT;
+                    attribute.offset = vertexLayout.attributeOffset;
+                    vkCmdSetVertexInputEXT(cmdBuffer, 1u, &binding, 1u, &attribute);
+
+                    float blendConstants[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+                    vkCmdSetBlendConstants(cmdBuffer, blendConstants);
+                    vkCmdSetColorBlendEnableEXT(cmdBuffer, 0u, 1u, &blendEnable);
+                    VkColorBlendEquationEXT colorBlendEquation = {VK_BLEND_FACTOR_CONSTANT_COLOR, VK_BLEND_FACTOR_ZERO,
+                                                                  VK_BLEND_OP_ADD,
+                                                                  VK_BLEND_FACTOR_CONSTANT_ALPHA, VK_BLEND_FACTOR_ZERO,
+                                                                  VK_BLEND_OP_ADD};
+                    vkCmdSetColorBlendEquationEXT(cmdBuffer, 0u, 1u, &colorBlendEquation);
+                });
+            }
+        }
+        // Each combination gets its pipeline at most once, the second pass finds them all
+        VkShaderObjectStatisticsKHRONOS after = GetStatistics();
+        if (pass == 0) {
+            ASSERT_LE(after.drawTimePipelineCount - before.drawTimePipelineCount, 4u);
+        } else {
+            ASSERT_EQ(after.drawTimePipelineCount - before.drawTimePipelineCount, 0u);
+        }
+    }
+
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(ShaderObjectAsyncPipelineTest, VertFragShader) {
+    TEST_DESCRIPTION("Test that draws switch to the optimized pipeline once it is compiled in the background");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    if (!CheckShaderObjectSupportAndInitState(false)) {
+        GTEST_SKIP() << kSkipPrefix << " shader object not supported, skipping test";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+
+    VkShaderEXT shaders[2];
+    CreateVertFragShaders(shaders);
+
+    // Draws keep looking up their draw state until its optimized pipeline is compiled
+    VkShaderObjectStatisticsKHRONOS before = GetStatistics();
+    DrawQuad(shaders, kQuadColor, 3u);
+    VkShaderObjectStatisticsKHRONOS after = GetStatistics();
+    ASSERT_EQ(after.drawTimePipelineCount - before.drawTimePipelineCount, 1u);
+    ASSERT_LE(after.drawStateLookupCount - before.drawStateLookupCount, 3u);
+    if (after.drawStateLookupCount - before.drawStateLookupCount > 1u) {
+        for (uint32_t i = 0; i < 1000u && GetStatistics().optimizedPipelineCount == before.optimizedPipelineCount; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(GetStatistics().optimizedPipelineCount - before.optimizedPipelineCount, 1u);
+    } else {
+        // No fast-linked pipeline, the draw state got its final pipeline right away
+        ASSERT_EQ(after.drawStateLookupCount - before.drawStateLookupCount, 1u);
+    }
+
+    // The first draw binds the optimized pipeline, later ones keep it bound without a lookup or a new pipeline
+    before = GetStatistics();
+    DrawQuad(shaders, kQuadColor, 3u);
+    after = GetStatistics();
+    ASSERT_EQ(after.drawStateLookupCount - before.drawStateLookupCount, 1u);
+    ASSERT_EQ(after.drawTimePipelineCount - before.drawTimePipelineCount, 0u);
+    ASSERT_EQ(after.optimizedPipelineCount - before.optimizedPipelineCount, 0u);
+
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    m_errorMonitor->VerifyNotFound();
+}
+
+ShaderObjectPipelineCacheTest::ShaderObjectPipelineCacheTest() {
+    pipeline_cache_path_ = (std::filesystem::temp_directory_path() / "shader_object_pipeline_cache_test").string();
+    std::error_code error;
+    std::filesystem::remove_all(pipeline_cache_path_, error);
+}
+
+TEST_F(ShaderObjectPipelineCacheTest, VertFragShader) {
+    TEST_DESCRIPTION("Test that pipelines created at draw time are stored in the pipeline cache directory");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    if (!CheckShaderObjectSupportAndInitState(false)) {
+        GTEST_SKIP() << kSkipPrefix << " shader object not supported, skipping test";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+
+    static const char vertSource[] = R"glsl(
+        #version 460
+        void main() {
+            vec2 pos = vec2(float(gl_VertexIndex & 1), float((gl_VertexIndex >> 1) & 1));
+            gl_Position = vec4(pos - 0.5f, 0.0f, 1.0f);
+        }
+    )glsl";
+
+    static const char fragSource[] = R"glsl(
+        #version 460
+        layout(location = 0) out vec4 uFragColor;
+        void main(){
+           uFragColor = vec4(0.2f, 0.4f, 0.6f, 0.8f);
+        }
+    )glsl";
+
+    VkShaderStageFlagBits shaderStages[] = {VK_SHADER_STAGE_VERTEX_BIT, VK_SHADER_STAGE_FRAGMENT_BIT};
+
+    std::vector<unsigned int> spv[2];
+    GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_VERTEX_BIT, vertSource, spv[0], false, 0);
+    GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_FRAGMENT_BIT, fragSource, spv[1], false, 0);
+
+    VkShaderStageFlagBits unusedShaderStages[] = {VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+                                                  VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT, VK_SHADER_STAGE_GEOMETRY_BIT};
+    VkShaderEXT shaders[2];
+    VkShaderCreateInfoEXT createInfos[2];
+    for (uint32_t i = 0; i < 2; ++i) {
+        createInfos[i] = vku::InitStructHelper();
+        createInfos[i].stage = shaderStages[i];
+        if (i == 0) {
+            createInfos[i].nextStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        }
+        createInfos[i].codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        createInfos[i].codeSize = spv[i].size() * sizeof(unsigned int);
+        createInfos[i].pCode = spv[i].data();
+        createInfos[i].pName = "main";
+    }
+
+    vkCreateShadersEXT(m_device->handle(), 2u, createInfos, nullptr, shaders);
+
+    VkBufferObj vertexBuffer;
+    vertexBuffer.init(*m_device, sizeof(float), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+    VkImageCreateInfo imageInfo = vku::InitStructHelper();
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    imageInfo.extent = {static_cast<uint32_t>(m_width), static_cast<uint32_t>(m_height), 1};
+    imageInfo.mipLevels = 1u;
+    imageInfo.arrayLayers = 1u;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImageObj image(m_device);
+    image.init(&imageInfo);
+    VkImageView view = image.targetView(imageInfo.format);
+
+    VkRenderingAttachmentInfo color_attachment = vku::InitStructHelper();
+    color_attachment.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    color_attachment.imageView = view;
+
+    VkRenderingInfo begin_rendering_info = vku::InitStructHelper();
+    begin_rendering_info.renderArea.extent.width = static_cast<uint32_t>(m_width);
+    begin_rendering_info.renderArea.extent.height = static_cast<uint32_t>(m_height);
+    begin_rendering_info.layerCount = 1u;
+    begin_rendering_info.colorAttachmentCount = 1u;
+    begin_rendering_info.pColorAttachments = &color_attachment;
+
+    m_commandBuffer->begin();
+    image.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    vkCmdBeginRenderingKHR(m_commandBuffer->handle(), &begin_rendering_info);
+    vkCmdBindShadersEXT(m_commandBuffer->handle(), 2u, shaderStages, shaders);
+    for (const auto& unusedShader : unusedShaderStages) {
+        VkShaderEXT null_shader = VK_NULL_HANDLE;
+        vkCmdBindShadersEXT(m_commandBuffer->handle(), 1u, &unusedShader, &null_shader);
+    }
+    BindDefaultDynamicStates(vertexBuffer.handle(), false);
+    vkCmdDraw(m_commandBuffer->handle(), 4, 1, 0, 0);
+    vkCmdEndRenderingKHR(m_commandBuffer->handle());
+    m_commandBuffer->end();
+
+    SubmitAndWait();
+
+    // Destroying the vertex shader stores its cache
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    size_t cache_files = 0;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(pipeline_cache_path_, error)) {
+        if (entry.path().filename().string().rfind("shader_object_", 0) == 0 && entry.path().extension() == ".bin") {
+            ++cache_files;
+        }
+    }
+    if (cache_files != 1) {
+        std::string msg = "Expected one pipeline cache file, found " + std::to_string(cache_files);
+        m_errorMonitor->SetError(msg.c_str());
+    }
+
+    m_errorMonitor->VerifyNotFound();
+}
+
+ShaderObjectDrawStateJournalTest::ShaderObjectDrawStateJournalTest() {
+    draw_state_journal_ = (std::filesystem::temp_directory_path() / "shader_object_draw_state_journal_test.bin").string();
+    std::error_code error;
+    std::filesystem::remove(draw_state_journal_, error);
+}
+
+TEST_F(ShaderObjectDrawStateJournalTest, VertFragShader) {
+    TEST_DESCRIPTION("Test that the pipeline of a journaled draw state is precompiled when the device is created again");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    if (!CheckShaderObjectSupportAndInitState(false)) {
+        GTEST_SKIP() << kSkipPrefix << " shader object not supported, skipping test";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+
+    // Linked shaders get a pipeline layout of their own, which the pipelines of journaled draw states are compiled with
+    VkShaderEXT shaders[2];
+    CreateVertFragShaders(shaders, VK_SHADER_CREATE_LINK_STAGE_BIT_EXT);
+    DrawQuad(shaders, kQuadColor);
+    ASSERT_EQ(GetStatistics().drawTimePipelineCount, 1u);
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    // The draw state is appended by a worker thread
+    std::error_code error;
+    for (uint32_t i = 0; i < 1000u && (std::filesystem::file_size(draw_state_journal_, error) == 0 || error); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (std::filesystem::file_size(draw_state_journal_, error) == 0 || error) {
+        m_errorMonitor->SetError("Draw state journal is empty");
+    }
+
+    // Creating the shaders again on a new device queues their journaled draw state
+    RecreateDevice();
+    CreateVertFragShaders(shaders, VK_SHADER_CREATE_LINK_STAGE_BIT_EXT);
+    for (uint32_t i = 0; i < 1000u && GetStatistics().precompiledPipelineCount == 0u; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(GetStatistics().precompiledPipelineCount, 1u);
+
+    // The draw finds the precompiled pipeline
+    DrawQuad(shaders, kQuadColor);
+    VkShaderObjectStatisticsKHRONOS statistics = GetStatistics();
+    ASSERT_EQ(statistics.drawStateLookupCount, 1u);
+    ASSERT_EQ(statistics.drawTimePipelineCount, 0u);
+
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(ShaderObjectTest, LinkedShadersDraw) {
     TEST_DESCRIPTION("Test drawing using linked shaders");
     SetTargetApiVersion(VK_API_VERSION_1_1);
@@ -1486,6 +2013,85 @@ TEST_F(ShaderObjectTest, UnusedAttachments) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(ShaderObjectTest, UnusedAttachmentsMultithreaded) {
+    TEST_DESCRIPTION("Test recording the same draw state with unused attachments on several threads at once");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    if (!DeviceExtensionSupported(VK_EXT_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_EXTENSION_NAME, 0)) {
+        GTEST_SKIP() << "VK_EXT_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_EXTENSION_NAME not supported";
+    }
+    m_device_extension_names.push_back(VK_EXT_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_EXTENSION_NAME);
+    if (!CheckShaderObjectSupportAndInitState(false)) {
+        GTEST_SKIP() << kSkipPrefix << " shader object or dynamic rendering unused attachments not supported, skipping test";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_1) {
+        GTEST_SKIP() << "At least Vulkan version 1.1 is required";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+
+    VkShaderEXT shaders[2];
+    CreateVertFragShaders(shaders);
+
+    constexpr uint32_t kThreadCount = 4u;
+    std::unique_ptr<VkCommandPoolObj> commandPools[kThreadCount];
+    std::unique_ptr<VkCommandBufferObj> commandBuffers[kThreadCount];
+    std::unique_ptr<VkImageObj> images[kThreadCount];
+    VkBufferObj colorBuffers[kThreadCount];
+    VkBufferObj vertexBuffers[kThreadCount];
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        commandPools[i] = std::make_unique<VkCommandPoolObj>(m_device, m_device->graphics_queue_node_index_);
+        commandBuffers[i] = std::make_unique<VkCommandBufferObj>(m_device, commandPools[i].get());
+        images[i] = std::make_unique<VkImageObj>(m_device);
+        InitColorImage(*images[i]);
+        colorBuffers[i].init(*m_device, sizeof(float) * 4u,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        vertexBuffers[i].init(*m_device, sizeof(float), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                              VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    }
+
+    // Every thread records the same draw state, so all but one of them wait for the pipeline another thread reserved
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            commandBuffers[i]->begin();
+            RecordQuad(commandBuffers[i]->handle(), shaders, *images[i], vertexBuffers[i].handle(), colorBuffers[i].handle(), 2u, 1u);
+            commandBuffers[i]->end();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    VkCommandBuffer commandBufferHandles[kThreadCount];
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        commandBufferHandles[i] = commandBuffers[i]->handle();
+    }
+    VkSubmitInfo submitInfo = vku::InitStructHelper();
+    submitInfo.commandBufferCount = kThreadCount;
+    submitInfo.pCommandBuffers = commandBufferHandles;
+    vkQueueSubmit(m_device->m_queue, 1, &submitInfo, VK_NULL_HANDLE);
+    vkQueueWaitIdle(m_device->m_queue);
+
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        CheckColor(colorBuffers[i], kQuadColor);
+    }
+
+    // A later draw finds the pipeline instead of creating another one
+    VkShaderObjectStatisticsKHRONOS before = GetStatistics();
+    m_commandBuffer->begin();
+    RecordQuad(m_commandBuffer->handle(), shaders, *images[0], vertexBuffers[0].handle(), colorBuffers[0].handle(), 1u, 1u);
+    m_commandBuffer->end();
+    SubmitAndWait();
+    CheckColor(colorBuffers[0], kQuadColor);
+    ASSERT_EQ(GetStatistics().drawTimePipelineCount, before.drawTimePipelineCount);
+
+    vkDestroyShaderEXT(m_device->handle(), shaders[0], nullptr);
+    vkDestroyShaderEXT(m_device->handle(), shaders[1], nullptr);
+
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(ShaderObjectTest, SetDebugName) {
     TEST_DESCRIPTION("Test drawing with a vertex and fragment shader");
     SetTargetApiVersion(VK_API_VERSION_1_1);
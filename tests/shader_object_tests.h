@@ -1,6 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <string>
+
 #include "extension_layer_tests.h"
+#include "shader_object_statistics.h"
 
 class ShaderObjectTest : public VkExtensionLayerTest {
   public:
@@ -8,6 +12,45 @@ class ShaderObjectTest : public VkExtensionLayerTest {
     void TearDown() override;
 
   protected:
-    void BindDefaultDynamicStates(VkBuffer buffer, bool tessellation);
+    void BindDefaultDynamicStates(VkBuffer buffer, bool tessellation, VkCommandBuffer cmdBuffer = VK_NULL_HANDLE);
     void SubmitAndWait();
+
+    // Creates a vertex and fragment shader, by default ones drawing a quad over the middle of the render area in kQuadColor
+    void CreateVertFragShaders(VkShaderEXT shaders[2], VkShaderCreateFlagsEXT flags = 0, const char* vertSource = nullptr,
+                               const char* fragSource = nullptr);
+    void InitColorImage(VkImageObj& image);
+    // Records drawing a quad drawCount times into image, cleared to zero first, and copying the color in its middle to
+    // colorBuffer. The rendering has unusedAttachmentCount attachments without an image view after the image. setState
+    // runs after the default dynamic states are set.
+    void RecordQuad(VkCommandBuffer cmdBuffer, VkShaderEXT const shaders[2], VkImageObj& image, VkBuffer vertexBuffer,
+                    VkBuffer colorBuffer, uint32_t drawCount = 1, uint32_t unusedAttachmentCount = 0,
+                    std::function<void(VkCommandBuffer)> const& setState = {});
+    void CheckColor(VkBufferObj& colorBuffer, float const expected[4]);
+    // Draws a quad with RecordQuad, submits it and checks its color
+    void DrawQuad(VkShaderEXT const shaders[2], float const expected[4], uint32_t drawCount = 1,
+                  std::function<void(VkCommandBuffer)> const& setState = {});
+    VkShaderObjectStatisticsKHRONOS GetStatistics();
+    // Destroys the device and creates it again with the same extensions and features, the instance is kept
+    void RecreateDevice();
+
+    static const float kQuadColor[4];
+
+    VkBool32 async_pipeline_compilation_ = VK_FALSE;
+    std::string pipeline_cache_path_;
+    std::string draw_state_journal_;
+};
+
+class ShaderObjectAsyncPipelineTest : public ShaderObjectTest {
+  public:
+    ShaderObjectAsyncPipelineTest() { async_pipeline_compilation_ = VK_TRUE; }
+};
+
+class ShaderObjectPipelineCacheTest : public ShaderObjectTest {
+  public:
+    ShaderObjectPipelineCacheTest();
+};
+
+class ShaderObjectDrawStateJournalTest : public ShaderObjectTest {
+  public:
+    ShaderObjectDrawStateJournalTest();
 };